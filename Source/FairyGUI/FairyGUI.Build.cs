@@ -34,6 +34,7 @@ public class FairyGUI : ModuleRules
 		PrivateDependencyModuleNames.AddRange(
 			new string[]
 			{
+				"ApplicationCore",
 				"CoreUObject",
 				"Engine",
                 "InputCore",
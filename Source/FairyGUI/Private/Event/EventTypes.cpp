@@ -18,6 +18,7 @@ const FName FUIEvents::RemovedFromStage("RemovedFromStage");
 
 const FName FUIEvents::Changed("Changed");
 const FName FUIEvents::ClickItem("ClickItem");
+const FName FUIEvents::ItemDeferredRenderComplete("ItemDeferredRenderComplete");
 const FName FUIEvents::ClickLink("ClickLink");
 const FName FUIEvents::GearStop("GearStop");
 
@@ -9,6 +9,7 @@
 #include "UI/GWindow.h"
 #include "UI/PopupMenu.h"
 #include "UI/DragDropManager.h"
+#include "UI/ScrollPane.h"
 #include "Tween/TweenManager.h"
 #include "Widgets/NTexture.h"
 #include "Utils/ByteBuffer.h"
@@ -101,6 +102,8 @@ void UFairyApplication::Destroy()
         it.Value->OnDestroy();
     }
     Instances.Reset();
+
+    FTweenManager::Singleton.Reset();
 }
 
 UFairyApplication::UFairyApplication() :
@@ -113,6 +116,8 @@ UFairyApplication::UFairyApplication() :
 
 void UFairyApplication::OnCreate()
 {
+    TweenManager = MakeUnique<FTweenManager>(this);
+
     ViewportClient = GameInstance->GetWorld()->GetGameViewport();
     if (ViewportClient == nullptr)
         return;
@@ -122,6 +127,7 @@ void UFairyApplication::OnCreate()
     DragDropManager = NewObject<UDragDropManager>(this);
     DragDropManager->CreateAgent();
 
+    PreTickDelegateHandle = FSlateApplication::Get().OnPreTick().AddUObject(this, &UFairyApplication::OnSlatePreTick);
     PostTickDelegateHandle = FSlateApplication::Get().OnPostTick().AddUObject(this, &UFairyApplication::OnSlatePostTick);
 
     InputProcessor = MakeShareable(new FInputProcessor(this));
@@ -131,11 +137,15 @@ void UFairyApplication::OnCreate()
 
 void UFairyApplication::OnDestroy()
 {
-    FTweenManager::Singleton.Reset();
+    //tweens of other game instances are not touched
+    TweenManager.Reset();
 
     if (InputProcessor.IsValid())
         FSlateApplication::Get().UnregisterInputPreProcessor(InputProcessor);
 
+    if (PreTickDelegateHandle.IsValid())
+        FSlateApplication::Get().OnPreTick().Remove(PreTickDelegateHandle);
+
     if (PostTickDelegateHandle.IsValid())
         FSlateApplication::Get().OnPostTick().Remove(PostTickDelegateHandle);
 }
@@ -157,6 +167,28 @@ void UFairyApplication::CallAfterSlateTick(FSimpleDelegate Callback)
     PostTickMulticastDelegate.Add(Callback);
 }
 
+void UFairyApplication::AddTickingScrollPane(UScrollPane* Pane)
+{
+    TickingScrollPanes.AddUnique(Pane);
+}
+
+void UFairyApplication::RemoveTickingScrollPane(UScrollPane* Pane)
+{
+    TickingScrollPanes.RemoveSingleSwap(Pane, false);
+}
+
+void UFairyApplication::OnSlatePreTick(float DeltaTime)
+{
+    //a flush may stage other objects, they are appended and flushed in the same pass
+    for (int32 i = 0; i < StagedObjects.Num(); i++)
+    {
+        UGObject* obj = StagedObjects[i].Get();
+        if (obj != nullptr)
+            obj->FlushStagedProperties();
+    }
+    StagedObjects.Reset();
+}
+
 void UFairyApplication::OnSlatePostTick(float DeltaTime)
 {
     if (PostTickMulticastDelegate.IsBound())
@@ -166,6 +198,20 @@ void UFairyApplication::OnSlatePostTick(float DeltaTime)
         Clone.Broadcast();
     }
 
+    if (TickingScrollPanes.Num() > 0)
+    {
+        //a pane leaves the list when its tween ends
+        TickingScrollPanesCopy = TickingScrollPanes;
+        for (auto& Pane : TickingScrollPanesCopy)
+        {
+            if (Pane.IsValid())
+                Pane->TweenUpdate(DeltaTime);
+            else
+                TickingScrollPanes.RemoveSingleSwap(Pane, false);
+        }
+        TickingScrollPanesCopy.Reset();
+    }
+
     if (bNeedCheckPopups)
     {
         bNeedCheckPopups = false;
@@ -0,0 +1,59 @@
+#include "Tween/EaseManager.h"
+#include "UI/UIConfig.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEaseTableTest, "FairyGUI.Tween.EaseTable",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FEaseTableTest::RunTest(const FString& Parameters)
+{
+    struct FEaseParams
+    {
+        float Duration;
+        float OvershootOrAmplitude;
+        float Period;
+    };
+
+    //the default overshoot, then overshoots, amplitudes and periods that need their own tables
+    static const FEaseParams Params[] = {
+        { 1, 1.70158f, 0 },
+        { 2, 2.5f, 0 },
+        { 2, 1.2f, 0.4f },
+        { 0.5f, 0.5f, 0.15f },
+    };
+    static const int32 Resolution = 256;
+    static const int32 Samples = 4000;
+    static const float MaxError = 0.005f;
+
+    const int32 OldResolution = FUIConfig::Config.EaseTableResolution;
+    FUIConfig::Config.EaseTableResolution = Resolution;
+
+    const UEnum* EaseEnum = StaticEnum<EEaseType>();
+    for (int32 Type = (int32)EEaseType::Linear; Type < (int32)EEaseType::Custom; Type++)
+    {
+        for (const FEaseParams& P : Params)
+        {
+            //sample between and on the table entries, including both ends
+            float Error = 0;
+            for (int32 i = 0; i <= Samples; i++)
+            {
+                float Time = P.Duration * i / Samples;
+                float Table = EaseManager::Evaluate((EEaseType)Type, Time, P.Duration, P.OvershootOrAmplitude, P.Period);
+                float Exact = EaseManager::EvaluateExact((EEaseType)Type, Time, P.Duration, P.OvershootOrAmplitude, P.Period);
+                Error = FMath::Max(Error, FMath::Abs(Table - Exact));
+            }
+
+            TestTrue(FString::Printf(TEXT("%s, duration %g, overshoot %g, period %g: max error %f"),
+                *EaseEnum->GetNameStringByValue(Type), P.Duration, P.OvershootOrAmplitude, P.Period, Error),
+                Error <= MaxError);
+        }
+    }
+
+    FUIConfig::Config.EaseTableResolution = OldResolution;
+
+    return true;
+}
+
+#endif
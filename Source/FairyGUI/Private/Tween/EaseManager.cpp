@@ -1,8 +1,107 @@
 #include "Tween/EaseManager.h"
+#include "UI/UIConfig.h"
 
 static const float _PiOver2 = (PI * 0.5f);
 static const float _TwoPi = (PI * 2);
 
+void EaseManager::EvaluateBatch(EEaseType EaseType, float* Times, int32 Count)
+{
+    switch (EaseType)
+    {
+    case EEaseType::Linear:
+        break;
+    case EEaseType::SineIn:
+        for (int32 i = 0; i < Count; i++)
+            Times[i] = -FMath::Cos(Times[i] * _PiOver2) + 1;
+        break;
+    case EEaseType::SineOut:
+        for (int32 i = 0; i < Count; i++)
+            Times[i] = FMath::Sin(Times[i] * _PiOver2);
+        break;
+    case EEaseType::SineInOut:
+        for (int32 i = 0; i < Count; i++)
+            Times[i] = -0.5f * (FMath::Cos(PI * Times[i]) - 1);
+        break;
+    case EEaseType::QuadIn:
+        for (int32 i = 0; i < Count; i++)
+            Times[i] = Times[i] * Times[i];
+        break;
+    case EEaseType::QuadOut:
+        for (int32 i = 0; i < Count; i++)
+            Times[i] = -Times[i] * (Times[i] - 2);
+        break;
+    case EEaseType::QuadInOut:
+        for (int32 i = 0; i < Count; i++)
+        {
+            float t = Times[i] * 2;
+            float u = t - 1;
+            Times[i] = t < 1 ? 0.5f * t * t : -0.5f * (u * (u - 2) - 1);
+        }
+        break;
+    case EEaseType::CubicIn:
+        for (int32 i = 0; i < Count; i++)
+            Times[i] = Times[i] * Times[i] * Times[i];
+        break;
+    case EEaseType::CubicOut:
+        for (int32 i = 0; i < Count; i++)
+        {
+            float t = Times[i] - 1;
+            Times[i] = t * t * t + 1;
+        }
+        break;
+    case EEaseType::CubicInOut:
+        for (int32 i = 0; i < Count; i++)
+        {
+            float t = Times[i] * 2;
+            float u = t - 2;
+            Times[i] = t < 1 ? 0.5f * t * t * t : 0.5f * (u * u * u + 2);
+        }
+        break;
+    case EEaseType::QuartIn:
+        for (int32 i = 0; i < Count; i++)
+            Times[i] = Times[i] * Times[i] * Times[i] * Times[i];
+        break;
+    case EEaseType::QuartOut:
+        for (int32 i = 0; i < Count; i++)
+        {
+            float t = Times[i] - 1;
+            Times[i] = -(t * t * t * t - 1);
+        }
+        break;
+    case EEaseType::QuartInOut:
+        for (int32 i = 0; i < Count; i++)
+        {
+            float t = Times[i] * 2;
+            float u = t - 2;
+            Times[i] = t < 1 ? 0.5f * t * t * t * t : -0.5f * (u * u * u * u - 2);
+        }
+        break;
+    case EEaseType::QuintIn:
+        for (int32 i = 0; i < Count; i++)
+            Times[i] = Times[i] * Times[i] * Times[i] * Times[i] * Times[i];
+        break;
+    case EEaseType::QuintOut:
+        for (int32 i = 0; i < Count; i++)
+        {
+            float t = Times[i] - 1;
+            Times[i] = t * t * t * t * t + 1;
+        }
+        break;
+    case EEaseType::QuintInOut:
+        for (int32 i = 0; i < Count; i++)
+        {
+            float t = Times[i] * 2;
+            float u = t - 2;
+            Times[i] = t < 1 ? 0.5f * t * t * t * t * t : 0.5f * (u * u * u * u * u + 2);
+        }
+        break;
+    default:
+        for (int32 i = 0; i < Count; i++)
+            Times[i] = Evaluate(EaseType, Times[i], 1, 1.70158f, 0);
+        break;
+    }
+}
+
 class Bounce
 {
 public:
@@ -11,7 +110,76 @@ public:
     static float EaseInOut(float Time, float Duration);
 };
 
+struct FEaseTableKey
+{
+    EEaseType EaseType;
+    float OvershootOrAmplitude;
+    float Period; //relative to the duration
+
+    bool operator==(const FEaseTableKey& Other) const
+    {
+        return EaseType == Other.EaseType && OvershootOrAmplitude == Other.OvershootOrAmplitude && Period == Other.Period;
+    }
+
+    friend uint32 GetTypeHash(const FEaseTableKey& Key)
+    {
+        return HashCombine(HashCombine(::GetTypeHash((uint8)Key.EaseType), ::GetTypeHash(Key.OvershootOrAmplitude)), ::GetTypeHash(Key.Period));
+    }
+};
+
+//every distinct overshoot or relative period gets its own table, past this the exact formula is used
+static const int32 MaxEaseTables = 64;
+static TMap<FEaseTableKey, TArray<float>> EaseTables;
+static int32 EaseTableResolution = 0;
+
+//circ, back and bounce are cheap to evaluate, and a table loses accuracy at the steep end of circ
+//and at the kinks of bounce
+static bool IsTabulated(EEaseType EaseType)
+{
+    return (EaseType >= EEaseType::SineIn && EaseType <= EEaseType::SineInOut)
+        || (EaseType >= EEaseType::ExpoIn && EaseType <= EEaseType::ExpoInOut)
+        || (EaseType >= EEaseType::ElasticIn && EaseType <= EEaseType::ElasticInOut);
+}
+
 float EaseManager::Evaluate(EEaseType EaseType, float Time, float Duration, float OvershootOrAmplitude, float Period)
+{
+    int32 resolution = FUIConfig::Config.EaseTableResolution;
+    if (resolution < 2 || Duration <= 0 || !IsTabulated(EaseType))
+        return EvaluateExact(EaseType, Time, Duration, OvershootOrAmplitude, Period);
+
+    if (resolution != EaseTableResolution)
+    {
+        EaseTables.Reset();
+        EaseTableResolution = resolution;
+    }
+
+    //Evaluate(t * d, d, a, p) == Evaluate(t, 1, a, p / d), so a table over normalized time fits any duration
+    bool bElastic = EaseType >= EEaseType::ElasticIn && EaseType <= EEaseType::ElasticInOut;
+    bool bBack = EaseType >= EEaseType::BackIn && EaseType <= EEaseType::BackInOut;
+    FEaseTableKey key;
+    key.EaseType = EaseType;
+    key.OvershootOrAmplitude = (bElastic || bBack) ? OvershootOrAmplitude : 0;
+    key.Period = bElastic ? Period / Duration : 0;
+
+    const TArray<float>* table = EaseTables.Find(key);
+    if (table == nullptr)
+    {
+        if (EaseTables.Num() >= MaxEaseTables)
+            return EvaluateExact(EaseType, Time, Duration, OvershootOrAmplitude, Period);
+
+        TArray<float>& samples = EaseTables.Add(key);
+        samples.SetNumUninitialized(resolution + 1);
+        for (int32 i = 0; i <= resolution; i++)
+            samples[i] = EvaluateExact(EaseType, (float)i / resolution, 1, key.OvershootOrAmplitude, key.Period);
+        table = &samples;
+    }
+
+    float pos = FMath::Clamp(Time / Duration, 0.0f, 1.0f) * resolution;
+    int32 i = FMath::Min(FMath::FloorToInt(pos), resolution - 1);
+    return FMath::Lerp((*table)[i], (*table)[i + 1], pos - i);
+}
+
+float EaseManager::EvaluateExact(EEaseType EaseType, float Time, float Duration, float OvershootOrAmplitude, float Period)
 {
     switch (EaseType)
     {
@@ -33,7 +33,8 @@ FGPathPoint::FGPathPoint(const FVector& InPos, ECurveType InCurveType)
 }
 
 FGPath::FGPath()
-    : FullLength(0)
+    : FullLength(0),
+    LastArcSample(0)
 {
 }
 
@@ -41,6 +42,7 @@ void FGPath::Create(const FGPathPoint* InPoints, int32 Count)
 {
     Segments.Reset();
     Points.Reset();
+    ArcSamples.Reset();
     FullLength = 0;
 
     if (Count == 0)
@@ -131,6 +133,81 @@ void FGPath::Clear()
 {
     Segments.Reset();
     Points.Reset();
+    ArcSamples.Reset();
+}
+
+void FGPath::BuildArcLengthTable(int32 SamplesPerSegment)
+{
+    ArcSamples.Reset();
+    LastArcSample = 0;
+
+    int32 cnt = Segments.Num();
+    if (cnt == 0)
+        return;
+
+    SamplesPerSegment = FMath::Max(SamplesPerSegment, 1);
+    ArcSamples.Reserve(cnt * (SamplesPerSegment + 1));
+
+    float dist = 0;
+    for (int32 i = 0; i < cnt; i++)
+    {
+        const FSegment& seg = Segments[i];
+        //a straight line is already uniform
+        int32 steps = seg.Type == FGPathPoint::ECurveType::Straight ? 1 : SamplesPerSegment;
+
+        FVector prev = GetPointInSegment(seg, 0);
+        ArcSamples.Add({ dist, i, 0 });
+        for (int32 j = 1; j <= steps; j++)
+        {
+            float t = (float)j / steps;
+            FVector pt = GetPointInSegment(seg, t);
+            dist += FVector::Dist(prev, pt);
+            ArcSamples.Add({ dist, i, t });
+            prev = pt;
+        }
+    }
+}
+
+FVector FGPath::GetPointInSegment(const FSegment& Seg, float Time)
+{
+    if (Seg.Type == FGPathPoint::ECurveType::Straight)
+        return FMath::Lerp(Points[Seg.PointStart], Points[Seg.PointStart + 1], Time);
+    else if (Seg.Type == FGPathPoint::ECurveType::Bezier || Seg.Type == FGPathPoint::ECurveType::CubicBezier)
+        return OnBezierCurve(Seg.PointStart, Seg.PointCount, Time);
+    else
+        return OnCRSplineCurve(Seg.PointStart, Seg.PointCount, Time);
+}
+
+FVector FGPath::GetPointByArcLength(float Time)
+{
+    int32 last = ArcSamples.Num() - 1;
+    float dist = Time * ArcSamples[last].Distance;
+    if (dist >= ArcSamples[last].Distance)
+        return GetPointInSegment(Segments[ArcSamples[last].Segment], 1);
+
+    //find i with Distance[i] <= dist < Distance[i + 1], zero-length steps between segments are skipped
+    int32 i = LastArcSample;
+    if (i > last || ArcSamples[i].Distance > dist)
+    {
+        int32 lo = 0, hi = last;
+        while (hi - lo > 1)
+        {
+            int32 mid = (lo + hi) / 2;
+            if (ArcSamples[mid].Distance <= dist)
+                lo = mid;
+            else
+                hi = mid;
+        }
+        i = lo;
+    }
+    while (i < last - 1 && ArcSamples[i + 1].Distance <= dist)
+        i++;
+    LastArcSample = i;
+
+    const FArcSample& s0 = ArcSamples[i];
+    const FArcSample& s1 = ArcSamples[i + 1];
+    float t = s0.Time + (s1.Time - s0.Time) * (dist - s0.Distance) / (s1.Distance - s0.Distance);
+    return GetPointInSegment(Segments[s0.Segment], t);
 }
 
 FVector FGPath::GetPointAt(float Time)
@@ -140,6 +217,9 @@ FVector FGPath::GetPointAt(float Time)
     if (cnt == 0)
         return FVector::ZeroVector;
 
+    if (ArcSamples.Num() > 0)
+        return GetPointByArcLength(Time);
+
     if (Time == 1)
     {
         const FSegment& seg = Segments[cnt - 1];
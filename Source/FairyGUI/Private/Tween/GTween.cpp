@@ -44,50 +44,50 @@ FGTweener* FGTween::Shake(const FVector2D& StartValue, float Amplitude, float Du
 
 bool FGTween::IsTweening(const FTweenerHandle& Handle)
 {
-    return FTweenManager::Singleton.IsTweening(Handle);
+    return FTweenManager::IsTweening(Handle);
 }
 
 bool FGTween::IsTweening(UObject* Target)
 {
-    return FTweenManager::Singleton.IsTweening(Target);
+    return FTweenManager::IsTweening(Target);
 }
 
 void FGTween::Kill(FTweenerHandle& Handle, bool bSetComplete)
 {
-    FTweenManager::Singleton.KillTween(Handle, bSetComplete);
+    FTweenManager::KillTween(Handle, bSetComplete);
 }
 
 void FGTween::Kill(UObject* Target, bool bSetComplete)
 {
-    FTweenManager::Singleton.KillTweens(Target, bSetComplete);
+    FTweenManager::KillTweens(Target, bSetComplete);
 }
 
 FGTweener* FGTween::GetTween(const FTweenerHandle& Handle)
 {
-    return FTweenManager::Singleton.GetTween(Handle);
+    return FTweenManager::GetTween(Handle);
 }
 
 FGTweener* FGTween::GetTween(UObject * Target)
 {
-    return FTweenManager::Singleton.GetTween(Target);
+    return FTweenManager::GetTween(Target);
 }
 
 void FGTweenAction::MoveX(FGTweener* Tweener)
 {
     UGObject * target = Cast<UGObject>(Tweener->GetTarget());
-    target->SetX(Tweener->Value.X);
+    target->StageX(Tweener->Value.X);
 }
 
 void FGTweenAction::MoveY(FGTweener* Tweener)
 {
     UGObject * target = Cast<UGObject>(Tweener->GetTarget());
-    target->SetY(Tweener->Value.X);
+    target->StageY(Tweener->Value.X);
 }
 
 void FGTweenAction::Move(FGTweener* Tweener)
 {
     UGObject * target = Cast<UGObject>(Tweener->GetTarget());
-    target->SetPosition(Tweener->Value.GetVec2());
+    target->StagePosition(Tweener->Value.GetVec2());
 }
 
 void FGTweenAction::SetWidth(FGTweener* Tweener)
@@ -105,7 +105,7 @@ void FGTweenAction::SetHeight(FGTweener* Tweener)
 void FGTweenAction::SetSize(FGTweener* Tweener)
 {
     UGObject * target = Cast<UGObject>(Tweener->GetTarget());
-    target->SetSize(Tweener->Value.GetVec2());
+    target->StageSize(Tweener->Value.GetVec2());
 }
 
 void FGTweenAction::ScaleX(FGTweener* Tweener)
@@ -135,7 +135,7 @@ void FGTweenAction::Rotate(FGTweener* Tweener)
 void FGTweenAction::SetAlpha(FGTweener* Tweener)
 {
     UGObject * target = Cast<UGObject>(Tweener->GetTarget());
-    target->SetAlpha(Tweener->Value.X);
+    target->StageAlpha(Tweener->Value.X);
 }
 
 void FGTweenAction::SetProgress(FGTweener* Tweener)
@@ -143,3 +143,53 @@ void FGTweenAction::SetProgress(FGTweener* Tweener)
     UGProgressBar * target = Cast<UGProgressBar>(Tweener->GetTarget());
     target->Update(Tweener->Value.X);
 }
+
+void FGTweenAction::SetProps(UObject* Target, ETweenPropType PropType, const FTweenValue& Value)
+{
+    UGObject* target = Cast<UGObject>(Target);
+    if (target == nullptr)
+        return;
+
+    switch (PropType)
+    {
+    case ETweenPropType::X:
+        target->StageX(Value.X);
+        break;
+    case ETweenPropType::Y:
+        target->StageY(Value.X);
+        break;
+    case ETweenPropType::Position:
+        target->StagePosition(Value.GetVec2());
+        break;
+    case ETweenPropType::Width:
+        target->SetWidth(Value.X);
+        break;
+    case ETweenPropType::Height:
+        target->SetHeight(Value.X);
+        break;
+    case ETweenPropType::Size:
+        target->StageSize(Value.GetVec2());
+        break;
+    case ETweenPropType::ScaleX:
+        target->SetScaleX(Value.X);
+        break;
+    case ETweenPropType::ScaleY:
+        target->SetScaleY(Value.X);
+        break;
+    case ETweenPropType::Scale:
+        target->SetScale(Value.GetVec2());
+        break;
+    case ETweenPropType::Rotation:
+        target->SetRotation(Value.X);
+        break;
+    case ETweenPropType::Alpha:
+        target->StageAlpha(Value.X);
+        break;
+    case ETweenPropType::Progress:
+        if (target->IsA<UGProgressBar>())
+            ((UGProgressBar*)target)->Update(Value.X);
+        break;
+    default:
+        break;
+    }
+}
@@ -1,4 +1,6 @@
 #include "Tween/GTweener.h"
+#include "Tween/GTween.h"
+#include "Tween/TweenManager.h"
 #include "Tween/EaseManager.h"
 #include "Tween/GPath.h"
 #include "UI/GObject.h"
@@ -68,10 +70,18 @@ FGTweener* FGTweener::SetSnapping(bool bInValue)
 
 FGTweener* FGTweener::SetTarget(UObject* InTarget)
 {
+    FTweenManager::SetTweenTarget(this, InTarget);
     Target = InTarget;
     return this;
 }
 
+FGTweener* FGTweener::SetTarget(UObject* InTarget, ETweenPropType InPropType)
+{
+    SetTarget(InTarget);
+    PropType = InPropType;
+    return this;
+}
+
 FGTweener* FGTweener::SetUserData(const FNVariant& InData)
 {
     UserData = InData;
@@ -245,6 +255,7 @@ FGTweener* FGTweener::Shake(const FVector2D& InStart, float InAmplitude, float I
 
 void FGTweener::Init()
 {
+    PropType = ETweenPropType::None;
     Delay = 0;
     Duration = 0;
     Breakpoint = -1;
@@ -403,19 +414,25 @@ void FGTweener::Update()
         Value.SetVec3(vec3);
     }
     else
-    {
-        for (int32 i = 0; i < ValueSize; i++)
-        {
-            float n1 = StartValue[i];
-            float n2 = EndValue[i];
-            float f = n1 + (n2 - n1) * NormalizedTime;
-            if (bSnapping)
-                f = FMath::RoundToFloat(f);
-            DeltaValue[i] = f - Value[i];
-            Value[i] = f;
-        }
-        Value.D = Value.X;
-    }
+        LerpValue();
+
+    if (PropType != ETweenPropType::None)
+        FGTweenAction::SetProps(Target.Get(), PropType, Value);
 
     OnUpdateCallback.ExecuteIfBound(this);
+}
+
+void FGTweener::LerpValue()
+{
+    for (int32 i = 0; i < ValueSize; i++)
+    {
+        float n1 = StartValue[i];
+        float n2 = EndValue[i];
+        float f = n1 + (n2 - n1) * NormalizedTime;
+        if (bSnapping)
+            f = FMath::RoundToFloat(f);
+        DeltaValue[i] = f - Value[i];
+        Value[i] = f;
+    }
+    Value.D = Value.X;
 }
\ No newline at end of file
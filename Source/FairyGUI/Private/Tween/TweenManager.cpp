@@ -1,11 +1,25 @@
 #include "Tween/TweenManager.h"
 #include "Tween/GTweener.h"
+#include "Tween/GTween.h"
+#include "Tween/EaseManager.h"
+#include "UI/GObject.h"
+#include "FairyApplication.h"
+
+DECLARE_CYCLE_STAT(TEXT("FairyGUI Tween Tick"), STAT_FairyGUITweenTick, STATGROUP_Game);
+
+//the shared registries are defined before the singleton so that they outlive its destructor
+uint32 FTweenManager::TweenerInstanceCount = 0;
+TArray<FGTweener*> FTweenManager::TweenerPool;
+TArray<FTweenManager::FSlot> FTweenManager::Slots;
+TMap<UObject*, TArray<FGTweener*, TInlineAllocator<2>>> FTweenManager::TargetTweens;
 
 FTweenManager FTweenManager::Singleton;
 
-FTweenManager::FTweenManager()
+FTweenManager::FTweenManager(UFairyApplication* InApp) :
+    App(InApp)
 {
     TotalActiveTweens = 0;
+    TickingCount = 0;
     ArrayLength = 30;
     ActiveTweens = new FGTweener*[ArrayLength];
 }
@@ -18,18 +32,45 @@ FTweenManager::~FTweenManager()
 
 void FTweenManager::Reset()
 {
-    for (auto it : TweenerPool)
-        delete it;
-    TweenerPool.Reset();
+    //only the tweeners owned by this manager are dropped, the other managers keep running.
+    //The shared pool goes with the singleton.
+    if (this == &Singleton)
+    {
+        for (auto it : TweenerPool)
+        {
+            ClearSlot(it);
+            delete it;
+        }
+        TweenerPool.Reset();
+    }
 
     int32 cnt = TotalActiveTweens;
     for (int32 i = 0; i < cnt; i++)
     {
         FGTweener* tweener = ActiveTweens[i];
         if (tweener != nullptr)
+        {
+            ClearSlot(tweener);
             delete tweener;
+        }
     }
     TotalActiveTweens = 0;
+    TickingCount = 0;
+
+    for (auto& it : Batches)
+    {
+        it.Tweeners.Reset();
+        it.Times.Reset();
+    }
+}
+
+void FTweenManager::ClearSlot(FGTweener* Tweener)
+{
+    //instance count is kept so that handles issued before stay invalid
+    RemoveFromTargetIndex(Tweener);
+    FSlot& slot = Slots[Tweener->Handle.GetIndex()];
+    slot.Tweener = nullptr;
+    slot.Manager = nullptr;
 }
 
 FGTweener* FTweenManager::CreateTween()
@@ -50,9 +91,22 @@ FGTweener* FTweenManager::CreateTween()
         }
         tweener = new FGTweener();
         tweener->Handle.SetIndex(TweenerInstanceCount);
+
+        int32 index = tweener->Handle.GetIndex();
+        if (index >= Slots.Num())
+            Slots.AddZeroed(index + 1 - Slots.Num());
+        Slots[index].Tweener = tweener;
     }
     tweener->Init();
-    ActiveTweens[TotalActiveTweens++] = tweener;
+    AddActive(tweener);
+
+    return tweener;
+}
+
+void FTweenManager::AddActive(FGTweener* Tweener)
+{
+    Slots[Tweener->Handle.GetIndex()].Manager = this;
+    ActiveTweens[TotalActiveTweens++] = Tweener;
 
     if (TotalActiveTweens == ArrayLength)
     {
@@ -63,26 +117,26 @@ FGTweener* FTweenManager::CreateTween()
         ActiveTweens = newArray;
         ArrayLength = newLen;
     }
+}
 
-    return tweener;
+bool FTweenManager::RemoveLatest(FGTweener* Tweener)
+{
+    if (TotalActiveTweens <= TickingCount || ActiveTweens[TotalActiveTweens - 1] != Tweener)
+        return false;
+
+    ActiveTweens[--TotalActiveTweens] = nullptr;
+    return true;
 }
 
 bool FTweenManager::KillTween(FTweenerHandle & Handle, bool bCompleted)
 {
-    int32 cnt = TotalActiveTweens;
-    for (int32 i = 0; i < cnt; i++)
-    {
-        FGTweener* tweener = ActiveTweens[i];
-        if (tweener != nullptr && tweener->Handle == Handle && !tweener->bKilled)
-        {
-            Handle.Invalidate();
-            tweener->Kill(bCompleted);
-            return true;
-        }
-    }
-
+    FGTweener* tweener = GetTween(Handle);
     Handle.Invalidate();
-    return false;
+    if (tweener == nullptr)
+        return false;
+
+    tweener->Kill(bCompleted);
+    return true;
 }
 
 bool FTweenManager::KillTweens(UObject* Target, bool bCompleted)
@@ -90,19 +144,22 @@ bool FTweenManager::KillTweens(UObject* Target, bool bCompleted)
     if (Target == nullptr)
         return false;
 
-    bool flag = false;
-    int32 cnt = TotalActiveTweens;
-    for (int32 i = 0; i < cnt; i++)
+    auto* tweens = TargetTweens.Find(Target);
+    if (tweens == nullptr)
+        return false;
+
+    //complete callbacks may start or retarget tweens, which changes the list
+    TArray<FGTweener*, TInlineAllocator<8>> toKill;
+    for (auto& it : *tweens)
     {
-        FGTweener* tweener = ActiveTweens[i];
-        if (tweener != nullptr && tweener->Target.Get() == Target && !tweener->bKilled)
-        {
-            tweener->Kill(bCompleted);
-            flag = true;
-        }
+        if (it->Target.Get() == Target && !it->bKilled)
+            toKill.Add(it);
     }
 
-    return flag;
+    for (auto& it : toKill)
+        it->Kill(bCompleted);
+
+    return toKill.Num() > 0;
 }
 
 FGTweener* FTweenManager::GetTween(FTweenerHandle const& Handle)
@@ -110,17 +167,15 @@ FGTweener* FTweenManager::GetTween(FTweenerHandle const& Handle)
     if (!Handle.IsValid())
         return nullptr;
 
-    int32 cnt = TotalActiveTweens;
-    for (int32 i = 0; i < cnt; i++)
-    {
-        FGTweener* tweener = ActiveTweens[i];
-        if (tweener != nullptr && tweener->Handle == Handle && !tweener->bKilled)
-        {
-            return tweener;
-        }
-    }
+    int32 index = Handle.GetIndex();
+    if (index >= Slots.Num())
+        return nullptr;
 
-    return nullptr;
+    FGTweener* tweener = Slots[index].Tweener;
+    if (tweener != nullptr && tweener->Handle == Handle && !tweener->bKilled)
+        return tweener;
+    else
+        return nullptr;
 }
 
 FGTweener* FTweenManager::GetTween(UObject* Target)
@@ -128,22 +183,73 @@ FGTweener* FTweenManager::GetTween(UObject* Target)
     if (Target == nullptr)
         return nullptr;
 
-    int32 cnt = TotalActiveTweens;
-    for (int32 i = 0; i < cnt; i++)
+    auto* tweens = TargetTweens.Find(Target);
+    if (tweens == nullptr)
+        return nullptr;
+
+    for (auto& it : *tweens)
     {
-        FGTweener* tweener = ActiveTweens[i];
-        if (tweener != nullptr && tweener->Target.Get() == Target && !tweener->bKilled)
-        {
-            return tweener;
-        }
+        if (it->Target.Get() == Target && !it->bKilled)
+            return it;
     }
 
     return nullptr;
 }
 
+void FTweenManager::SetTweenTarget(FGTweener* Tweener, UObject* Target)
+{
+    RemoveFromTargetIndex(Tweener);
+    if (Target == nullptr)
+        return;
+
+    FSlot& slot = Slots[Tweener->Handle.GetIndex()];
+    TargetTweens.FindOrAdd(Target).Add(Tweener);
+    slot.IndexedTarget = Target;
+
+    //a tween is created on the singleton and moves to the application of its target, so that it is
+    //ticked with that game instance and dropped when it goes away.
+    //It can only move while it is still the newest entry of the manager and not being ticked.
+    UGObject* obj = Cast<UGObject>(Target);
+    if (obj == nullptr || obj->GetWorld() == nullptr || !obj->GetWorld()->IsGameWorld())
+        return;
+
+    FTweenManager& manager = obj->GetApp()->GetTweenManager();
+    if (slot.Manager != &manager && slot.Manager != nullptr && slot.Manager->RemoveLatest(Tweener))
+        manager.AddActive(Tweener);
+}
+
+void FTweenManager::RemoveFromTargetIndex(FGTweener* Tweener)
+{
+    FSlot& slot = Slots[Tweener->Handle.GetIndex()];
+    if (slot.IndexedTarget == nullptr)
+        return;
+
+    auto* tweens = TargetTweens.Find(slot.IndexedTarget);
+    if (tweens != nullptr)
+    {
+        tweens->RemoveSingleSwap(Tweener, false);
+        if (tweens->Num() == 0)
+            TargetTweens.Remove(slot.IndexedTarget);
+    }
+    slot.IndexedTarget = nullptr;
+}
+
+UWorld* FTweenManager::GetTickableGameObjectWorld() const
+{
+    return App != nullptr ? App->GetWorld() : nullptr;
+}
+
+TStatId FTweenManager::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(FTweenManager, STATGROUP_Tickables);
+}
+
 void FTweenManager::Tick(float DeltaTime)
 {
+    SCOPE_CYCLE_COUNTER(STAT_FairyGUITweenTick);
+
     int32 cnt = TotalActiveTweens;
+    TickingCount = cnt;
     int32 freePosStart = -1;
     for (int32 i = 0; i < cnt; i++)
     {
@@ -155,7 +261,9 @@ void FTweenManager::Tick(float DeltaTime)
         }
         else if (tweener->bKilled)
         {
+            RemoveFromTargetIndex(tweener);
             tweener->Reset();
+            Slots[tweener->Handle.GetIndex()].Manager = nullptr;
             TweenerPool.Add(tweener);
             ActiveTweens[i] = nullptr;
 
@@ -167,7 +275,12 @@ void FTweenManager::Tick(float DeltaTime)
             if (tweener->Target.IsStale())
                 tweener->bKilled = true;
             else if (!tweener->bPaused)
-                tweener->Update(DeltaTime);
+            {
+                if (tweener->IsBatchable())
+                    AddToBatch(tweener, DeltaTime);
+                else
+                    tweener->Update(DeltaTime);
+            }
 
             if (freePosStart != -1)
             {
@@ -189,4 +302,62 @@ void FTweenManager::Tick(float DeltaTime)
         }
         TotalActiveTweens = freePosStart;
     }
+    TickingCount = 0;
+
+    UpdateBatches();
+}
+
+void FTweenManager::AddToBatch(FGTweener* Tweener, float DeltaTime)
+{
+    if (Tweener->TimeScale != 1)
+        DeltaTime *= Tweener->TimeScale;
+    if (DeltaTime == 0)
+        return;
+
+    Tweener->ElapsedTime += DeltaTime;
+    float tt = Tweener->ElapsedTime - Tweener->Delay;
+    if (tt >= Tweener->Duration)
+    {
+        tt = Tweener->Duration;
+        Tweener->Ended = 1;
+    }
+
+    FTweenBatch& batch = Batches[(int32)Tweener->EaseType];
+    batch.Tweeners.Add(Tweener);
+    batch.Times.Add(tt / Tweener->Duration);
+}
+
+void FTweenManager::UpdateBatches()
+{
+    for (int32 b = 0; b < BatchCount; b++)
+    {
+        FTweenBatch& batch = Batches[b];
+        int32 cnt = batch.Tweeners.Num();
+        if (cnt == 0)
+            continue;
+
+        EaseManager::EvaluateBatch((EEaseType)b, batch.Times.GetData(), cnt);
+
+        for (int32 i = 0; i < cnt; i++)
+        {
+            FGTweener* tweener = batch.Tweeners[i];
+            if (tweener->bKilled) //by a callback earlier in this batch
+                continue;
+
+            tweener->NormalizedTime = batch.Times[i];
+            tweener->Value.Reset();
+            tweener->DeltaValue.Reset();
+            tweener->LerpValue();
+            FGTweenAction::SetProps(tweener->Target.Get(), tweener->PropType, tweener->Value);
+
+            if (tweener->Ended != 0 && !tweener->bKilled)
+            {
+                tweener->OnCompleteCallback.ExecuteIfBound(tweener);
+                tweener->bKilled = true;
+            }
+        }
+
+        batch.Tweeners.Reset();
+        batch.Times.Reset();
+    }
 }
\ No newline at end of file
@@ -11,6 +11,7 @@
 #include "Utils/ByteBuffer.h"
 #include "Widgets/SContainer.h"
 #include "Widgets/HitTest.h"
+#include "Utils/SpatialGrid.h"
 #include "Tween/GTween.h"
 #include "FairyApplication.h"
 
@@ -68,6 +69,7 @@ UGObject* UGComponent::AddChildAt(UGObject* Child, int32 Index)
             Children.Insert(Child, Index);
 
         ChildStateChanged(Child);
+        ChildBoundsChanged(Child);
         SetBoundsChangedFlag();
     }
     return Child;
@@ -118,6 +120,8 @@ void UGComponent::RemoveChildAt(int32 Index)
     }
 
     Children.RemoveAt(Index);
+    if (ChildGrid.IsValid())
+        ChildGrid->Remove(Child);
     SetBoundsChangedFlag();
 }
 
@@ -362,6 +366,33 @@ bool UGComponent::IsChildInView(UGObject* Child) const
 
 int32 UGComponent::GetFirstChildInView() const
 {
+    if (ChildGrid.IsValid() && ScrollPane != nullptr)
+    {
+        FVector2D pos(ScrollPane->GetPosX(), ScrollPane->GetPosY());
+        TArray<UGObject*> candidates;
+        GetChildrenInRect(FBox2D(pos, pos + ScrollPane->GetViewSize()), candidates);
+        if (candidates.Num() == 0)
+            return -1;
+
+        //child indices are cached in the grid and refreshed in one pass once one of them is found stale
+        int32 first = MAX_int32;
+        for (UGObject* Obj : candidates)
+        {
+            if (!IsChildInView(Obj))
+                continue;
+
+            int32 index = ChildGrid->GetIndexHint(Obj);
+            if (!Children.IsValidIndex(index) || Children[index] != Obj)
+            {
+                for (int32 i = 0; i < Children.Num(); i++)
+                    ChildGrid->SetIndexHint(Children[i], i);
+                index = ChildGrid->GetIndexHint(Obj);
+            }
+            first = FMath::Min(first, index);
+        }
+        return first != MAX_int32 ? first : -1;
+    }
+
     int32 i = 0;
     for (auto& Obj : Children)
     {
@@ -413,8 +444,7 @@ void UGComponent::ApplyController(UGController* Controller)
 {
     ApplyingController = Controller;
 
-    for (int32 i = 0; i < Children.Num(); i++)
-        Children[i]->HandleControllerChanged(Controller);
+    Controller->NotifySubscribers(this);
 
     ApplyingController = nullptr;
 
@@ -545,6 +575,47 @@ void UGComponent::SetHitArea(const TSharedPtr<IHitTest>& InHitArea)
     DisplayObject->UpdateVisibilityFlags();
 }
 
+void UGComponent::SetChildSpatialIndex(float CellSize)
+{
+    if (CellSize <= 0)
+    {
+        ChildGrid.Reset();
+        return;
+    }
+
+    if (ChildGrid.IsValid() && ChildGrid->GetCellSize() == CellSize)
+        return;
+
+    ChildGrid = MakeShareable(new FSpatialGrid(CellSize));
+    for (auto& Child : Children)
+        UpdateChildGrid(Child);
+}
+
+void UGComponent::UpdateChildGrid(UGObject* Child)
+{
+    ChildGrid->Update(Child, FBox2D(Child->GetPosition(), Child->GetPosition() + Child->GetSize()));
+}
+
+void UGComponent::GetChildrenInRect(const FBox2D& Rect, TArray<UGObject*>& OutChildren) const
+{
+    if (ChildGrid.IsValid())
+    {
+        ChildGrid->Query(Rect, OutChildren);
+        return;
+    }
+
+    for (auto& Child : Children)
+    {
+        if (FBox2D(Child->GetPosition(), Child->GetPosition() + Child->GetSize()).Intersect(Rect))
+            OutChildren.Add(Child);
+    }
+}
+
+void UGComponent::GetChildrenAtPoint(const FVector2D& Point, TArray<UGObject*>& OutChildren) const
+{
+    GetChildrenInRect(FBox2D(Point, Point), OutChildren);
+}
+
 void UGComponent::SetBoundsChangedFlag()
 {
     if (bBoundsChanged)
@@ -567,7 +638,15 @@ void UGComponent::EnsureBoundsCorrect()
 void UGComponent::UpdateBounds()
 {
     float ax, ay, aw, ah;
-    if (Children.Num() > 0)
+    FBox2D GridBounds;
+    if (ChildGrid.IsValid() && ChildGrid->GetBounds(GridBounds))
+    {
+        ax = GridBounds.Min.X;
+        ay = GridBounds.Min.Y;
+        aw = GridBounds.Max.X - ax;
+        ah = GridBounds.Max.Y - ay;
+    }
+    else if (Children.Num() > 0)
     {
         ax = FLT_MAX;
         ay = FLT_MAX;
@@ -613,7 +692,7 @@ void UGComponent::SetBounds(float ax, float ay, float aw, float ah)
 
 void UGComponent::ChildStateChanged(UGObject* Child)
 {
-    if (bBuildingDisplayList)
+    if (bBuildingDisplayList || bBatchingChildren)
         return;
 
     int32 cnt = Children.Num();
@@ -1102,17 +1181,28 @@ void UGComponent::ConstructFromResource(TArray<UGObject*>* ObjectPool, int32 Poo
 
     Buffer->Seek(0, 5);
 
-    int32 transitionCount = Buffer->ReadShort();
-    for (int32 i = 0; i < transitionCount; i++)
+    //the first instance parses the transitions, the others only create their playback state
+    if (!ContentItem->Transitions.IsSet())
     {
-        int32 nextPos = Buffer->ReadShort();
-        nextPos += Buffer->GetPos();
+        ContentItem->Transitions.Emplace();
+
+        int32 transitionCount = Buffer->ReadShort();
+        for (int32 i = 0; i < transitionCount; i++)
+        {
+            int32 nextPos = Buffer->ReadShort();
+            nextPos += Buffer->GetPos();
+
+            ContentItem->Transitions->Add(UTransition::CreateDefinition(Buffer, this));
 
+            Buffer->SetPos(nextPos);
+        }
+    }
+
+    for (auto& it : ContentItem->Transitions.GetValue())
+    {
         UTransition* Transition = NewObject<UTransition>(this);
         Transitions.Add(Transition);
-        Transition->Setup(Buffer);
-
-        Buffer->SetPos(nextPos);
+        Transition->Setup(it);
     }
 
     if (Transitions.Num() > 0) {
@@ -1151,7 +1241,7 @@ void UGComponent::SetupAfterAdd(FByteBuffer* Buffer, int32 BeginPos)
 
     int32 pageController = Buffer->ReadShort();
     if (pageController != -1 && ScrollPane != nullptr && ScrollPane->bPageMode)
-        ScrollPane->PageController = Parent->GetControllerAt(pageController);
+        ScrollPane->SetPageController(Parent->GetControllerAt(pageController));
 
     int32 cnt = Buffer->ReadShort();
     for (int32 i = 0; i < cnt; i++)
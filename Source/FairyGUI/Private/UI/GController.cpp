@@ -127,6 +127,48 @@ void UGController::SetOppositePageID(const FString& PageID)
         SetSelectedIndex(1);
 }
 
+void UGController::AddSubscriber(UGObject* Obj)
+{
+    int32* index = SubscriberIndices.Find(Obj);
+    if (index != nullptr)
+    {
+        //the address may belong to a new object if the old one died before a dispatch noticed it
+        Subscribers[*index].Object = Obj;
+        return;
+    }
+
+    int32 slot;
+    if (FreeSubscriberSlots.Num() > 0)
+        slot = FreeSubscriberSlots.Pop(false);
+    else
+        slot = Subscribers.AddDefaulted();
+
+    Subscribers[slot].Key = Obj;
+    Subscribers[slot].Object = Obj;
+    SubscriberIndices.Add(Obj, slot);
+}
+
+void UGController::NotifySubscribers(UGComponent* Parent)
+{
+    //subscribers that were moved to another component keep their slot but are skipped
+    for (int32 i = 0; i < Subscribers.Num(); i++)
+    {
+        FSubscriber& subscriber = Subscribers[i];
+        if (subscriber.Key == nullptr)
+            continue;
+
+        UGObject* Obj = subscriber.Object.Get();
+        if (Obj == nullptr)
+        {
+            SubscriberIndices.Remove(subscriber.Key);
+            subscriber.Key = nullptr;
+            FreeSubscriberSlots.Add(i);
+        }
+        else if (Obj->GetParent() == Parent)
+            Obj->HandleControllerChanged(this);
+    }
+}
+
 void UGController::RunActions()
 {
     if (Actions.Num() == 0)
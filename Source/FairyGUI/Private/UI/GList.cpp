@@ -11,7 +11,9 @@
 UGList::FItemInfo::FItemInfo() :
     Obj(nullptr),
     UpdateFlag(0),
-    bSelected(false)
+    bSelected(false),
+    RenderState(0),
+    Key(0)
 {
 }
 
@@ -19,7 +21,13 @@ UGList::UGList() :
     bScrollItemToViewOnClick(true),
     bAutoResizeItem(true),
     LastSelectedIndex(-1),
-    FirstIndex(-1)
+    FirstIndex(-1),
+    PrefetchTime(0.25f),
+    RenderBudgetFrame(0),
+    RenderedInFrame(0),
+    bDeferredRelayout(false),
+    bDeferredRendered(false),
+    PrefetchedExtent(0)
 {
     bTrackBounds = true;
     SetOpaque(true);
@@ -162,6 +170,52 @@ UGObject* UGList::AddItemFromPool(const FString& URL)
     return AddChild(Obj);
 }
 
+void UGList::AddItemsFromPool(int32 Count, const FString& URL)
+{
+    int32 firstIndex = BeginAddItems();
+    for (int32 i = 0; i < Count; i++)
+        AddItemFromPool(URL);
+    EndAddItems(firstIndex);
+}
+
+int32 UGList::BeginAddItems()
+{
+    //already suspended, e.g. under construction, the caller will build the display list
+    if (bBuildingDisplayList || bBatchingChildren)
+        return -1;
+
+    bBatchingChildren = true;
+    return Children.Num();
+}
+
+void UGList::EndAddItems(int32 StartIndex)
+{
+    if (StartIndex < 0)
+        return;
+
+    bBatchingChildren = false;
+
+    int32 cnt = Children.Num();
+    if (ChildrenRenderOrder == EChildrenRenderOrder::Ascent && SortingChildCount == 0)
+    {
+        //new items are all at the end, and so are their display objects
+        TArray<TSharedRef<SWidget>> widgets;
+        widgets.Reserve(cnt - StartIndex);
+        for (int32 i = StartIndex; i < cnt; i++)
+        {
+            UGObject* Child = Children[i];
+            if (Child->InternalVisible())
+                widgets.Add(Child->DisplayObject.ToSharedRef());
+        }
+        Container->AddChildren(widgets);
+    }
+    else
+    {
+        for (int32 i = 0; i < cnt; i++)
+            ChildStateChanged(Children[i]);
+    }
+}
+
 UGObject* UGList::AddChildAt(UGObject* Child, int32 Index)
 {
     UGComponent::AddChildAt(Child, Index);
@@ -251,6 +305,8 @@ void UGList::SetSelectedIndex(int32 Index)
 void UGList::SetSelectionController(UGController* InController)
 {
     SelectionController = InController;
+    if (SelectionController != nullptr)
+        SelectionController->AddSubscriber(this);
 }
 
 void UGList::GetSelection(TArray<int32>& OutIndice) const
@@ -838,17 +894,13 @@ void UGList::ScrollToView(int32 Index, bool bAnimation, bool bSetFirst)
         FItemInfo& ii = VirtualItems[Index];
         if (Layout == EListLayoutType::SingleColumn || Layout == EListLayoutType::FlowHorizontal)
         {
-            float pos = 0;
-            for (int32 i = CurLineItemCount - 1; i < Index; i += CurLineItemCount)
-                pos += VirtualItems[i].Size.Y + LineGap;
+            float pos = LineSizes.GetSum(Index / CurLineItemCount, LineGap);
             rect.Min.Set(0, pos);
             rect.Max = rect.Min + FVector2D(ItemSize.X, ii.Size.Y);
         }
         else if (Layout == EListLayoutType::SingleRow || Layout == EListLayoutType::FlowVertical)
         {
-            float pos = 0;
-            for (int32 i = CurLineItemCount - 1; i < Index; i += CurLineItemCount)
-                pos += VirtualItems[i].Size.X + ColumnGap;
+            float pos = LineSizes.GetSum(Index / CurLineItemCount, ColumnGap);
             rect.Min.Set(pos, 0);
             rect.Max = rect.Min + FVector2D(ii.Size.X, ItemSize.Y);
         }
@@ -1011,12 +1063,30 @@ void UGList::SetNumItems(int32 InNumItems)
             RealNumItems = NumItems;
 
         int32 oldCount = VirtualItems.Num();
+
+        //existing rows now showing other data take the size cached for it, the others keep their measured size
+        if (ItemKeyProvider.IsBound())
+        {
+            int32 cnt = FMath::Min(oldCount, RealNumItems);
+            for (int32 i = 0; i < cnt; i++)
+            {
+                int64 key = ItemKeyProvider.Execute(i % NumItems);
+                if (VirtualItems[i].Key != key)
+                {
+                    VirtualItems[i].Key = key;
+                    SetEstimatedItemSize(i, GetEstimatedItemSize(i));
+                }
+            }
+        }
+
         if (RealNumItems > oldCount)
         {
             for (int32 i = oldCount; i < RealNumItems; i++)
             {
                 FItemInfo ii;
-                ii.Size = ItemSize;
+                ii.Size = GetEstimatedItemSize(i);
+                if (ItemKeyProvider.IsBound())
+                    ii.Key = ItemKeyProvider.Execute(i % NumItems);
 
                 VirtualItems.Add(MoveTemp(ii));
             }
@@ -1037,6 +1107,7 @@ void UGList::SetNumItems(int32 InNumItems)
         int32 cnt = Children.Num();
         if (InNumItems > cnt)
         {
+            int32 firstIndex = BeginAddItems();
             for (int32 i = cnt; i < InNumItems; i++)
             {
                 if (!ItemProvider.IsBound())
@@ -1044,6 +1115,7 @@ void UGList::SetNumItems(int32 InNumItems)
                 else
                     AddItemFromPool(ItemProvider.Execute(i));
             }
+            EndAddItems(firstIndex);
         }
         else
         {
@@ -1104,6 +1176,134 @@ void UGList::CheckVirtualList()
     }
 }
 
+void UGList::SpliceVirtualItems(int32 Index, int32 RemoveCount, int32 InsertCount)
+{
+    verifyf(bVirtual && !bLoop, TEXT("Splicing needs a virtual list without loop"));
+
+    TArray<TPair<UGObject*, uint8>> cells;
+    int32 begin = TakeVirtualCells(cells);
+
+    VirtualItems.RemoveAt(Index, RemoveCount, false);
+    NumItems = RealNumItems = RealNumItems - RemoveCount + InsertCount;
+    VirtualItems.InsertDefaulted(Index, InsertCount);
+    for (int32 i = Index; i < Index + InsertCount; i++)
+        VirtualItems[i].Size = GetEstimatedItemSize(i);
+
+    if (LastSelectedIndex >= Index + RemoveCount)
+        LastSelectedIndex += InsertCount - RemoveCount;
+    else if (LastSelectedIndex >= Index)
+        LastSelectedIndex = -1;
+
+    RestoreVirtualCells(begin, cells);
+    SpliceLineSizes(Index, RemoveCount, InsertCount);
+    RefreshSplicedItems();
+}
+
+void UGList::MoveVirtualItems(int32 Index, int32 Count, int32 NewIndex)
+{
+    verifyf(bVirtual && !bLoop, TEXT("Splicing needs a virtual list without loop"));
+
+    TArray<TPair<UGObject*, uint8>> cells;
+    int32 begin = TakeVirtualCells(cells);
+
+    TArray<FItemInfo> items(VirtualItems.GetData() + Index, Count);
+    VirtualItems.RemoveAt(Index, Count, false);
+    VirtualItems.Insert(MoveTemp(items), NewIndex);
+
+    if (LastSelectedIndex >= Index && LastSelectedIndex < Index + Count)
+        LastSelectedIndex += NewIndex - Index;
+    else
+    {
+        if (LastSelectedIndex >= Index + Count)
+            LastSelectedIndex -= Count;
+        if (LastSelectedIndex >= NewIndex)
+            LastSelectedIndex += Count;
+    }
+
+    RestoreVirtualCells(begin, cells);
+    SpliceLineSizes(Index, Count, 0);
+    SpliceLineSizes(NewIndex, 0, Count);
+    RefreshSplicedItems();
+}
+
+int32 UGList::TakeVirtualCells(TArray<TPair<UGObject*, uint8>>& OutCells)
+{
+    //take the cells out of their rows, their selection state is kept by the row
+    int32 begin = 0;
+    int32 end = VirtualItems.Num();
+    if (Layout != EListLayoutType::Pagination && FirstIndex >= 0)
+    {
+        begin = FMath::Min(FirstIndex, end);
+        end = FMath::Min(FirstIndex + NumChildren(), end);
+    }
+
+    OutCells.Reserve(end - begin);
+    for (int32 i = begin; i < end; i++)
+    {
+        FItemInfo& ii = VirtualItems[i];
+        if (Cast<UGButton>(ii.Obj))
+            ii.bSelected = ((UGButton*)ii.Obj)->IsSelected();
+        OutCells.Emplace(ii.Obj, ii.RenderState);
+        ii.Obj = nullptr;
+        ii.RenderState = 0;
+    }
+
+    return begin;
+}
+
+void UGList::RestoreVirtualCells(int32 Begin, const TArray<TPair<UGObject*, uint8>>& Cells)
+{
+    //put the cells back where they were, showing the selection of the rows now under them
+    for (int32 i = VirtualItems.Num(); i < Begin + Cells.Num(); i++)
+    {
+        FItemInfo ii;
+        ii.Size = ItemSize;
+        VirtualItems.Add(MoveTemp(ii));
+    }
+    for (int32 i = 0; i < Cells.Num(); i++)
+    {
+        FItemInfo& ii = VirtualItems[Begin + i];
+        ii.Obj = Cells[i].Key;
+        ii.RenderState = Cells[i].Value;
+        if (Cast<UGButton>(ii.Obj))
+            ((UGButton*)ii.Obj)->SetSelected(ii.bSelected);
+    }
+}
+
+void UGList::SpliceLineSizes(int32 Index, int32 RemoveCount, int32 InsertCount)
+{
+    if (CurLineItemCount <= 0)
+        return;
+
+    if (CurLineItemCount == 1)
+    {
+        //one item per line, the lines are spliced like the items
+        if (Index > LineSizes.Num())
+            return;
+
+        bool bVertical = Layout == EListLayoutType::SingleColumn || Layout == EListLayoutType::FlowHorizontal;
+        TArray<float> sizes;
+        sizes.Reserve(InsertCount);
+        for (int32 i = Index; i < Index + InsertCount; i++)
+            sizes.Add(bVertical ? VirtualItems[i].Size.Y : VirtualItems[i].Size.X);
+        LineSizes.Splice(Index, RemoveCount, sizes);
+    }
+    else
+    {
+        //the items shift between lines, UpdateLineSizes adds the lines from the first changed one again
+        LineSizes.Truncate(Index / CurLineItemCount);
+    }
+}
+
+void UGList::RefreshSplicedItems()
+{
+    //the line index is already up to date, only the items in view are laid out again
+    if (VirtualListChanged == 0)
+        VirtualListChanged = 1;
+    GetApp()->CancelDelayCall(RefreshTimerHandle);
+    DoRefreshVirtualList();
+}
+
 void UGList::SetVirtualListChangedFlag(bool bLayoutChanged)
 {
     if (bLayoutChanged)
@@ -1167,15 +1367,15 @@ void UGList::DoRefreshVirtualList()
             }
         }
     }
+    UpdateLineSizes(bLayoutChanged);
+
     float ch = 0, cw = 0;
     if (RealNumItems > 0)
     {
-        int32 len = FMath::FloorToInt((float)RealNumItems / CurLineItemCount) * CurLineItemCount;
         int32 len2 = FMath::Min(CurLineItemCount, RealNumItems);
         if (Layout == EListLayoutType::SingleColumn || Layout == EListLayoutType::FlowHorizontal)
         {
-            for (int32 i = 0; i < len; i += CurLineItemCount)
-                ch += VirtualItems[i].Size.Y + LineGap;
+            ch = LineSizes.GetTotal(LineGap);
             if (ch > 0)
                 ch -= LineGap;
 
@@ -1191,8 +1391,7 @@ void UGList::DoRefreshVirtualList()
         }
         else if (Layout == EListLayoutType::SingleRow || Layout == EListLayoutType::FlowVertical)
         {
-            for (int32 i = 0; i < len; i += CurLineItemCount)
-                cw += VirtualItems[i].Size.X + ColumnGap;
+            cw = LineSizes.GetTotal(ColumnGap);
             if (cw > 0)
                 cw -= ColumnGap;
 
@@ -1208,6 +1407,7 @@ void UGList::DoRefreshVirtualList()
         }
         else
         {
+            int32 len = FMath::FloorToInt((float)RealNumItems / CurLineItemCount) * CurLineItemCount;
             int32 pageCount = FMath::CeilToInt((float)len / (CurLineItemCount * CurLineItemCount2));
             cw = pageCount * GetViewWidth();
             ch = GetViewHeight();
@@ -1222,6 +1422,28 @@ void UGList::DoRefreshVirtualList()
     HandleScroll(true);
 }
 
+void UGList::UpdateLineSizes(bool bRebuild)
+{
+    int32 lineCount = 0;
+    if (Layout != EListLayoutType::Pagination && CurLineItemCount > 0)
+        lineCount = FMath::DivideAndRoundUp(RealNumItems, CurLineItemCount);
+
+    if (bRebuild)
+        LineSizes.Reset();
+
+    if (lineCount < LineSizes.Num())
+        LineSizes.Truncate(lineCount);
+    else
+    {
+        bool bVertical = Layout == EListLayoutType::SingleColumn || Layout == EListLayoutType::FlowHorizontal;
+        for (int32 i = LineSizes.Num(); i < lineCount; i++)
+        {
+            const FVector2D& size = VirtualItems[i * CurLineItemCount].Size;
+            LineSizes.Add(bVertical ? size.Y : size.X);
+        }
+    }
+}
+
 void UGList::OnScrollHandler(UEventContext* Context)
 {
     HandleScroll(false);
@@ -1235,60 +1457,16 @@ int32 UGList::GetIndexOnPos1(float& pos, bool forceUpdate)
         return 0;
     }
 
-    if (NumChildren() > 0 && !forceUpdate)
+    //a line is hit while pos is above its bottom edge, or above the next line when the gap is positive
+    int32 line = LineSizes.Find(pos + FMath::Min(LineGap, 0), LineGap);
+    if (line < LineSizes.Num())
     {
-        float pos2 = GetChildAt(0)->GetY();
-        if (pos2 + (LineGap > 0 ? 0 : -LineGap) > pos)
-        {
-            for (int32 i = FirstIndex - CurLineItemCount; i >= 0; i -= CurLineItemCount)
-            {
-                pos2 -= (VirtualItems[i].Size.Y + LineGap);
-                if (pos2 <= pos)
-                {
-                    pos = pos2;
-                    return i;
-                }
-            }
-
-            pos = 0;
-            return 0;
-        }
-        else
-        {
-            float testGap = LineGap > 0 ? LineGap : 0;
-            for (int32 i = FirstIndex; i < RealNumItems; i += CurLineItemCount)
-            {
-                float pos3 = pos2 + VirtualItems[i].Size.Y;
-                if (pos3 + testGap > pos)
-                {
-                    pos = pos2;
-                    return i;
-                }
-                pos2 = pos3 + LineGap;
-            }
-
-            pos = pos2;
-            return RealNumItems - CurLineItemCount;
-        }
+        pos = LineSizes.GetSum(line, LineGap);
+        return line * CurLineItemCount;
     }
-    else
-    {
-        float pos2 = 0;
-        float testGap = LineGap > 0 ? LineGap : 0;
-        for (int32 i = 0; i < RealNumItems; i += CurLineItemCount)
-        {
-            float pos3 = pos2 + VirtualItems[i].Size.Y;
-            if (pos3 + testGap > pos)
-            {
-                pos = pos2;
-                return i;
-            }
-            pos2 = pos3 + LineGap;
-        }
 
-        pos = pos2;
-        return RealNumItems - CurLineItemCount;
-    }
+    pos = LineSizes.GetTotal(LineGap);
+    return RealNumItems - CurLineItemCount;
 }
 
 int32 UGList::GetIndexOnPos2(float& pos, bool forceUpdate)
@@ -1299,60 +1477,15 @@ int32 UGList::GetIndexOnPos2(float& pos, bool forceUpdate)
         return 0;
     }
 
-    if (NumChildren() > 0 && !forceUpdate)
+    int32 line = LineSizes.Find(pos + FMath::Min(ColumnGap, 0), ColumnGap);
+    if (line < LineSizes.Num())
     {
-        float pos2 = GetChildAt(0)->GetX();
-        if (pos2 + (ColumnGap > 0 ? 0 : -ColumnGap) > pos)
-        {
-            for (int32 i = FirstIndex - CurLineItemCount; i >= 0; i -= CurLineItemCount)
-            {
-                pos2 -= (VirtualItems[i].Size.X + ColumnGap);
-                if (pos2 <= pos)
-                {
-                    pos = pos2;
-                    return i;
-                }
-            }
-
-            pos = 0;
-            return 0;
-        }
-        else
-        {
-            float testGap = ColumnGap > 0 ? ColumnGap : 0;
-            for (int32 i = FirstIndex; i < RealNumItems; i += CurLineItemCount)
-            {
-                float pos3 = pos2 + VirtualItems[i].Size.X;
-                if (pos3 + testGap > pos)
-                {
-                    pos = pos2;
-                    return i;
-                }
-                pos2 = pos3 + ColumnGap;
-            }
-
-            pos = pos2;
-            return RealNumItems - CurLineItemCount;
-        }
+        pos = LineSizes.GetSum(line, ColumnGap);
+        return line * CurLineItemCount;
     }
-    else
-    {
-        float pos2 = 0;
-        float testGap = ColumnGap > 0 ? ColumnGap : 0;
-        for (int32 i = 0; i < RealNumItems; i += CurLineItemCount)
-        {
-            float pos3 = pos2 + VirtualItems[i].Size.X;
-            if (pos3 + testGap > pos)
-            {
-                pos = pos2;
-                return i;
-            }
-            pos2 = pos3 + ColumnGap;
-        }
 
-        pos = pos2;
-        return RealNumItems - CurLineItemCount;
-    }
+    pos = LineSizes.GetTotal(ColumnGap);
+    return RealNumItems - CurLineItemCount;
 }
 
 int32 UGList::GetIndexOnPos3(float& pos, bool forceUpdate)
@@ -1426,16 +1559,231 @@ void UGList::HandleScroll(bool forceUpdate)
     bBoundsChanged = false;
 }
 
+void UGList::GetPrefetchMargins(int32 Axis, float& OutBefore, float& OutAfter) const
+{
+    OutBefore = OutAfter = 0;
+    if (PrefetchMargin <= 0)
+        return;
+
+    float viewSize = ScrollPane->GetViewSize().Component(Axis);
+    float v = ScrollPane->GetScrollingVelocity().Component(Axis);
+    float ahead = FMath::Min(PrefetchMargin + FMath::Abs(v) * PrefetchTime, FMath::Max(PrefetchMargin, viewSize * 2));
+    //round up to quarters of the view, so that the list isn't laid out again on every small speed change
+    float step = FMath::Max(viewSize / 4, 1.f);
+    ahead = FMath::CeilToFloat(ahead / step) * step;
+
+    if (v >= 0)
+    {
+        OutBefore = PrefetchMargin;
+        OutAfter = ahead;
+    }
+    else
+    {
+        OutBefore = ahead;
+        OutAfter = PrefetchMargin;
+    }
+}
+
+FVector2D UGList::GetEstimatedItemSize(int32 Index)
+{
+    if (ItemKeyProvider.IsBound())
+    {
+        const FVector2D* Measured = MeasuredSizes.Find(ItemKeyProvider.Execute(Index % NumItems));
+        if (Measured != nullptr)
+            return *Measured;
+    }
+
+    if (ItemSizeProvider.IsBound())
+    {
+        FVector2D size = ItemSizeProvider.Execute(Index % NumItems);
+        if (size.X > 0 && size.Y > 0)
+            return FVector2D(FMath::CeilToFloat(size.X), FMath::CeilToFloat(size.Y));
+    }
+
+    return ItemSize;
+}
+
+void UGList::CacheMeasuredSize(int32 Index, const FVector2D& InSize)
+{
+    if (!ItemKeyProvider.IsBound())
+        return;
+
+    int64 key = ItemKeyProvider.Execute(Index % NumItems);
+    VirtualItems[Index].Key = key;
+    MeasuredSizes.Add(key, InSize);
+
+    //keep only the keys still in the data once the cache outgrows it, amortized O(1) per measurement
+    if (MeasuredSizes.Num() > FMath::Max(NumItems * 2, 256))
+    {
+        TMap<int64, FVector2D> kept;
+        kept.Reserve(NumItems);
+        for (int32 i = 0; i < NumItems; i++)
+        {
+            int64 key = ItemKeyProvider.Execute(i);
+            const FVector2D* size = MeasuredSizes.Find(key);
+            if (size != nullptr)
+                kept.Add(key, *size);
+        }
+        MeasuredSizes = MoveTemp(kept);
+    }
+}
+
+void UGList::RefreshItemSize(int32 Index)
+{
+    if (!bVirtual || Index < 0 || Index >= NumItems)
+        return;
+
+    if (ItemKeyProvider.IsBound())
+        MeasuredSizes.Remove(ItemKeyProvider.Execute(Index));
+
+    //every copy of the item in a looping list
+    for (int32 i = Index; i < RealNumItems; i += NumItems)
+        SetEstimatedItemSize(i, GetEstimatedItemSize(i));
+
+    SetVirtualListChangedFlag(false);
+}
+
+void UGList::SetEstimatedItemSize(int32 Index, const FVector2D& InSize)
+{
+    VirtualItems[Index].Size = InSize;
+
+    //the line is updated in place if the item leads one
+    if (CurLineItemCount > 0 && Index % CurLineItemCount == 0 && Index / CurLineItemCount < LineSizes.Num())
+    {
+        bool bVertical = Layout == EListLayoutType::SingleColumn || Layout == EListLayoutType::FlowHorizontal;
+        LineSizes.Set(Index / CurLineItemCount, bVertical ? InSize.Y : InSize.X);
+    }
+}
+
+bool UGList::AllowItemRender(int32 Index, bool bForce)
+{
+    FItemInfo& ii = VirtualItems[Index];
+    if (ItemRenderBudget <= 0)
+    {
+        //the cell may have been deferred before the budget was turned off
+        if (ii.RenderState != 0)
+        {
+            ii.RenderState = 0;
+            if (!ItemPlaceholderRenderer.IsBound())
+                ii.Obj->SetVisible(true);
+        }
+        return true;
+    }
+
+    if (RenderBudgetFrame != GFrameCounter)
+    {
+        RenderBudgetFrame = GFrameCounter;
+        RenderedInFrame = 0;
+    }
+
+    if (bForce || RenderedInFrame < ItemRenderBudget)
+    {
+        RenderedInFrame++;
+        ii.RenderState = 0;
+        //the object may come from a deferred cell
+        if (!ItemPlaceholderRenderer.IsBound())
+            ii.Obj->SetVisible(true);
+        return true;
+    }
+
+    if (ii.RenderState != 1)
+    {
+        ii.RenderState = 1;
+        DeferredItems.Add(Index);
+    }
+
+    if (ItemPlaceholderRenderer.IsBound())
+        ItemPlaceholderRenderer.Execute(Index % NumItems, ii.Obj);
+    else
+        ii.Obj->SetVisible(false);
+
+    GetApp()->DelayCall(DeferredRenderTimerHandle, this, &UGList::RenderDeferredItems);
+    return false;
+}
+
+void UGList::RenderDeferredItems()
+{
+    //allow rescheduling from inside the callback
+    DeferredRenderTimerHandle.Invalidate();
+
+    for (int32 i = DeferredItems.Num() - 1; i >= 0; i--)
+    {
+        int32 index = DeferredItems[i];
+        if (index < RealNumItems && VirtualItems[index].RenderState == 1 && VirtualItems[index].Obj != nullptr)
+            continue;
+
+        if (index < VirtualItems.Num())
+            VirtualItems[index].RenderState = 0;
+        DeferredItems.RemoveAtSwap(i, 1, false);
+    }
+
+    if (DeferredItems.Num() > 0 && bVirtual)
+    {
+        FVector2D center(ScrollPane->GetScrollingPosX(), ScrollPane->GetScrollingPosY());
+        center += ScrollPane->GetViewSize() / 2;
+        DeferredItems.Sort([this, &center](int32 a, int32 b)
+        {
+            UGObject* obj1 = VirtualItems[a].Obj;
+            UGObject* obj2 = VirtualItems[b].Obj;
+            return FVector2D::DistSquared(obj1->GetPosition() + obj1->GetSize() / 2, center)
+                < FVector2D::DistSquared(obj2->GetPosition() + obj2->GetSize() / 2, center);
+        });
+
+        if (RenderBudgetFrame != GFrameCounter)
+        {
+            RenderBudgetFrame = GFrameCounter;
+            RenderedInFrame = 0;
+        }
+
+        int32 cnt = FMath::Min(DeferredItems.Num(), FMath::Max(ItemRenderBudget - RenderedInFrame, 1));
+        for (int32 i = 0; i < cnt; i++)
+            VirtualItems[DeferredItems[i]].RenderState = 2;
+        DeferredItems.RemoveAt(0, cnt, false);
+        bDeferredRendered = true;
+
+        //lay the list out again, the scheduled cells are rendered and measured there
+        bDeferredRelayout = true;
+        HandleScroll(false);
+        bDeferredRelayout = false;
+    }
+
+    if (DeferredItems.Num() > 0)
+        GetApp()->DelayCall(DeferredRenderTimerHandle, this, &UGList::RenderDeferredItems);
+    else if (bDeferredRendered)
+    {
+        bDeferredRendered = false;
+        DispatchEvent(FUIEvents::ItemDeferredRenderComplete);
+    }
+}
+
 bool UGList::HandleScroll1(bool forceUpdate)
 {
     float pos = ScrollPane->GetScrollingPosY();
     float max = pos + ScrollPane->GetViewSize().Y;
     bool end = max == ScrollPane->GetContentSize().Y;
 
+    float before, after;
+    GetPrefetchMargins(1, before, after);
+    float keepPos = pos - before - PrefetchMargin;
+    pos -= before;
+
     int32 newFirstIndex = GetIndexOnPos1(pos, forceUpdate);
-    if (newFirstIndex == FirstIndex && !forceUpdate)
+    if (PrefetchMargin > 0 && !forceUpdate && FirstIndex >= 0 && FirstIndex < newFirstIndex && FirstIndex % CurLineItemCount == 0)
+    {
+        float firstPos = LineSizes.GetSum(FirstIndex / CurLineItemCount, LineGap);
+        if (firstPos + LineSizes.Get(FirstIndex / CurLineItemCount) > keepPos)
+        {
+            newFirstIndex = FirstIndex;
+            pos = firstPos;
+        }
+    }
+
+    if (newFirstIndex == FirstIndex && !forceUpdate && !bDeferredRelayout && after <= PrefetchedExtent)
         return false;
 
+    PrefetchedExtent = after;
+    max += after;
+
     int32 oldFirstIndex = FirstIndex;
     FirstIndex = newFirstIndex;
     int32 curIndex = newFirstIndex;
@@ -1447,11 +1795,13 @@ bool UGList::HandleScroll1(bool forceUpdate)
     bool needRender;
     float deltaSize = 0;
     float firstItemDeltaSize = 0;
-    FString url = DefaultItem;
+    int32 defaultHandle = Pool->GetHandle(DefaultItem);
+    int32 handle = defaultHandle;
     int32 partSize = (int32)((ScrollPane->GetViewSize().X - ColumnGap * (CurLineItemCount - 1)) / CurLineItemCount);
 
     ItemInfoVer++;
-    while (curIndex < RealNumItems && (end || curY < max))
+    while (curIndex < RealNumItems && (end || curY < max
+        || (PrefetchMargin > 0 && curY < max + PrefetchMargin && VirtualItems[curIndex].Obj != nullptr)))
     {
         FItemInfo& ii = VirtualItems[curIndex];
 
@@ -1459,13 +1809,11 @@ bool UGList::HandleScroll1(bool forceUpdate)
         {
             if (ItemProvider.IsBound())
             {
-                url = ItemProvider.Execute(curIndex % NumItems);
-                if (url.Len() == 0)
-                    url = DefaultItem;
-                url = UUIPackage::NormalizeURL(url);
+                FString url = ItemProvider.Execute(curIndex % NumItems);
+                handle = url.Len() == 0 ? defaultHandle : Pool->GetHandle(url);
             }
 
-            if (ii.Obj != nullptr && ii.Obj->GetResourceURL().Compare(url) != 0)
+            if (ii.Obj != nullptr && ii.Obj->GetResourceHandle() != handle)
             {
                 if (Cast<UGButton>(ii.Obj))
                     ii.bSelected = ((UGButton*)ii.Obj)->IsSelected();
@@ -1481,7 +1829,7 @@ bool UGList::HandleScroll1(bool forceUpdate)
                 for (int32 j = reuseIndex; j >= oldFirstIndex; j--)
                 {
                     FItemInfo& ii2 = VirtualItems[j];
-                    if (ii2.Obj != nullptr && ii2.UpdateFlag != ItemInfoVer && ii2.Obj->GetResourceURL().Compare(url) == 0)
+                    if (ii2.Obj != nullptr && ii2.UpdateFlag != ItemInfoVer && ii2.Obj->GetResourceHandle() == handle)
                     {
                         if (Cast<UGButton>(ii2.Obj))
                             ii2.bSelected = ((UGButton*)ii2.Obj)->IsSelected();
@@ -1498,7 +1846,7 @@ bool UGList::HandleScroll1(bool forceUpdate)
                 for (int32 j = reuseIndex; j <= lastIndex; j++)
                 {
                     FItemInfo& ii2 = VirtualItems[j];
-                    if (ii2.Obj != nullptr && ii2.UpdateFlag != ItemInfoVer && ii2.Obj->GetResourceURL().Compare(url) == 0)
+                    if (ii2.Obj != nullptr && ii2.UpdateFlag != ItemInfoVer && ii2.Obj->GetResourceHandle() == handle)
                     {
                         if (Cast<UGButton>(ii2.Obj))
                             ii2.bSelected = ((UGButton*)ii2.Obj)->IsSelected();
@@ -1517,7 +1865,7 @@ bool UGList::HandleScroll1(bool forceUpdate)
             }
             else
             {
-                ii.Obj = Pool->GetObject(url, this);
+                ii.Obj = Pool->GetObject(handle, this);
                 if (forward)
                     AddChildAt(ii.Obj, curIndex - newFirstIndex);
                 else
@@ -1526,10 +1874,10 @@ bool UGList::HandleScroll1(bool forceUpdate)
             if (Cast<UGButton>(ii.Obj))
                 ((UGButton*)ii.Obj)->SetSelected(ii.bSelected);
 
-            needRender = true;
+            needRender = AllowItemRender(curIndex, false);
         }
         else
-            needRender = forceUpdate;
+            needRender = (forceUpdate || ii.RenderState == 2) && AllowItemRender(curIndex, true);
 
         if (needRender)
         {
@@ -1547,6 +1895,9 @@ bool UGList::HandleScroll1(bool forceUpdate)
             }
             ii.Size.X = FMath::CeilToFloat(ii.Obj->GetWidth());
             ii.Size.Y = FMath::CeilToFloat(ii.Obj->GetHeight());
+            if (curIndex % CurLineItemCount == 0)
+                LineSizes.Set(curIndex / CurLineItemCount, ii.Size.Y);
+            CacheMeasuredSize(curIndex, ii.Size);
         }
 
         ii.UpdateFlag = ItemInfoVer;
@@ -1599,10 +1950,28 @@ bool UGList::HandleScroll2(bool forceUpdate)
     float max = pos + ScrollPane->GetViewSize().X;
     bool end = pos == ScrollPane->GetContentSize().X;
 
+    float before, after;
+    GetPrefetchMargins(0, before, after);
+    float keepPos = pos - before - PrefetchMargin;
+    pos -= before;
+
     int32 newFirstIndex = GetIndexOnPos2(pos, forceUpdate);
-    if (newFirstIndex == FirstIndex && !forceUpdate)
+    if (PrefetchMargin > 0 && !forceUpdate && FirstIndex >= 0 && FirstIndex < newFirstIndex && FirstIndex % CurLineItemCount == 0)
+    {
+        float firstPos = LineSizes.GetSum(FirstIndex / CurLineItemCount, ColumnGap);
+        if (firstPos + LineSizes.Get(FirstIndex / CurLineItemCount) > keepPos)
+        {
+            newFirstIndex = FirstIndex;
+            pos = firstPos;
+        }
+    }
+
+    if (newFirstIndex == FirstIndex && !forceUpdate && !bDeferredRelayout && after <= PrefetchedExtent)
         return false;
 
+    PrefetchedExtent = after;
+    max += after;
+
     int32 oldFirstIndex = FirstIndex;
     FirstIndex = newFirstIndex;
     int32 curIndex = newFirstIndex;
@@ -1614,11 +1983,13 @@ bool UGList::HandleScroll2(bool forceUpdate)
     bool needRender;
     float deltaSize = 0;
     float firstItemDeltaSize = 0;
-    FString url = DefaultItem;
+    int32 defaultHandle = Pool->GetHandle(DefaultItem);
+    int32 handle = defaultHandle;
     int32 partSize = (int32)((ScrollPane->GetViewSize().Y - LineGap * (CurLineItemCount - 1)) / CurLineItemCount);
 
     ItemInfoVer++;
-    while (curIndex < RealNumItems && (end || curX < max))
+    while (curIndex < RealNumItems && (end || curX < max
+        || (PrefetchMargin > 0 && curX < max + PrefetchMargin && VirtualItems[curIndex].Obj != nullptr)))
     {
         FItemInfo& ii = VirtualItems[curIndex];
 
@@ -1626,13 +1997,11 @@ bool UGList::HandleScroll2(bool forceUpdate)
         {
             if (ItemProvider.IsBound())
             {
-                url = ItemProvider.Execute(curIndex % NumItems);
-                if (url.Len() == 0)
-                    url = DefaultItem;
-                url = UUIPackage::NormalizeURL(url);
+                FString url = ItemProvider.Execute(curIndex % NumItems);
+                handle = url.Len() == 0 ? defaultHandle : Pool->GetHandle(url);
             }
 
-            if (ii.Obj != nullptr && ii.Obj->GetResourceURL().Compare(url) != 0)
+            if (ii.Obj != nullptr && ii.Obj->GetResourceHandle() != handle)
             {
                 if (Cast<UGButton>(ii.Obj))
                     ii.bSelected = ((UGButton*)ii.Obj)->IsSelected();
@@ -1648,7 +2017,7 @@ bool UGList::HandleScroll2(bool forceUpdate)
                 for (int32 j = reuseIndex; j >= oldFirstIndex; j--)
                 {
                     FItemInfo& ii2 = VirtualItems[j];
-                    if (ii2.Obj != nullptr && ii2.UpdateFlag != ItemInfoVer && ii2.Obj->GetResourceURL().Compare(url) == 0)
+                    if (ii2.Obj != nullptr && ii2.UpdateFlag != ItemInfoVer && ii2.Obj->GetResourceHandle() == handle)
                     {
                         if (Cast<UGButton>(ii2.Obj))
                             ii2.bSelected = ((UGButton*)ii2.Obj)->IsSelected();
@@ -1665,7 +2034,7 @@ bool UGList::HandleScroll2(bool forceUpdate)
                 for (int32 j = reuseIndex; j <= lastIndex; j++)
                 {
                     FItemInfo& ii2 = VirtualItems[j];
-                    if (ii2.Obj != nullptr && ii2.UpdateFlag != ItemInfoVer && ii2.Obj->GetResourceURL().Compare(url) == 0)
+                    if (ii2.Obj != nullptr && ii2.UpdateFlag != ItemInfoVer && ii2.Obj->GetResourceHandle() == handle)
                     {
                         if (Cast<UGButton>(ii2.Obj))
                             ii2.bSelected = ((UGButton*)ii2.Obj)->IsSelected();
@@ -1684,7 +2053,7 @@ bool UGList::HandleScroll2(bool forceUpdate)
             }
             else
             {
-                ii.Obj = Pool->GetObject(url, this);
+                ii.Obj = Pool->GetObject(handle, this);
                 if (forward)
                     AddChildAt(ii.Obj, curIndex - newFirstIndex);
                 else
@@ -1693,10 +2062,10 @@ bool UGList::HandleScroll2(bool forceUpdate)
             if (Cast<UGButton>(ii.Obj))
                 ((UGButton*)ii.Obj)->SetSelected(ii.bSelected);
 
-            needRender = true;
+            needRender = AllowItemRender(curIndex, false);
         }
         else
-            needRender = forceUpdate;
+            needRender = (forceUpdate || ii.RenderState == 2) && AllowItemRender(curIndex, true);
 
         if (needRender)
         {
@@ -1714,6 +2083,9 @@ bool UGList::HandleScroll2(bool forceUpdate)
             }
             ii.Size.X = FMath::CeilToFloat(ii.Obj->GetWidth());
             ii.Size.Y = FMath::CeilToFloat(ii.Obj->GetHeight());
+            if (curIndex % CurLineItemCount == 0)
+                LineSizes.Set(curIndex / CurLineItemCount, ii.Size.X);
+            CacheMeasuredSize(curIndex, ii.Size);
         }
 
         ii.UpdateFlag = ItemInfoVer;
@@ -1765,7 +2137,7 @@ void UGList::HandleScroll3(bool forceUpdate)
     float pos = ScrollPane->GetScrollingPosX();
 
     int32 newFirstIndex = GetIndexOnPos3(pos, forceUpdate);
-    if (newFirstIndex == FirstIndex && !forceUpdate)
+    if (newFirstIndex == FirstIndex && !forceUpdate && !bDeferredRelayout)
         return;
 
     int32 oldFirstIndex = FirstIndex;
@@ -1780,7 +2152,8 @@ void UGList::HandleScroll3(bool forceUpdate)
     int32 startIndex = page * pageSize;
     int32 lastIndex = startIndex + pageSize * 2;
     bool needRender;
-    FString url = DefaultItem;
+    int32 defaultHandle = Pool->GetHandle(DefaultItem);
+    int32 handle = defaultHandle;
     int32 partWidth = (int32)((ScrollPane->GetViewSize().X - ColumnGap * (CurLineItemCount - 1)) / CurLineItemCount);
     int32 partHeight = (int32)((ScrollPane->GetViewSize().Y - LineGap * (CurLineItemCount2 - 1)) / CurLineItemCount2);
     ItemInfoVer++;
@@ -1841,13 +2214,11 @@ void UGList::HandleScroll3(bool forceUpdate)
             {
                 if (ItemProvider.IsBound())
                 {
-                    url = ItemProvider.Execute(i % NumItems);
-                    if (url.Len() == 0)
-                        url = DefaultItem;
-                    url = UUIPackage::NormalizeURL(url);
+                    FString url = ItemProvider.Execute(i % NumItems);
+                    handle = url.Len() == 0 ? defaultHandle : Pool->GetHandle(url);
                 }
 
-                ii.Obj = Pool->GetObject(url, this);
+                ii.Obj = Pool->GetObject(handle, this);
                 AddChildAt(ii.Obj, insertIndex);
             }
             else
@@ -1859,11 +2230,11 @@ void UGList::HandleScroll3(bool forceUpdate)
             if (Cast<UGButton>(ii.Obj))
                 ((UGButton*)ii.Obj)->SetSelected(ii.bSelected);
 
-            needRender = true;
+            needRender = AllowItemRender(i, false);
         }
         else
         {
-            needRender = forceUpdate;
+            needRender = (forceUpdate || ii.RenderState == 2) && AllowItemRender(i, true);
             insertIndex = -1;
             lastObj = ii.Obj;
         }
@@ -1883,6 +2254,7 @@ void UGList::HandleScroll3(bool forceUpdate)
             ItemRenderer.ExecuteIfBound(i % NumItems, ii.Obj);
             ii.Size.X = FMath::CeilToFloat(ii.Obj->GetWidth());
             ii.Size.Y = FMath::CeilToFloat(ii.Obj->GetHeight());
+            CacheMeasuredSize(i, ii.Size);
         }
     }
 
@@ -2503,5 +2875,5 @@ void UGList::SetupAfterAdd(FByteBuffer* Buffer, int32 BeginPos)
 
     int32 i = Buffer->ReadShort();
     if (i != -1)
-        SelectionController = Parent->GetControllerAt(i);
+        SetSelectionController(Parent->GetControllerAt(i));
 }
\ No newline at end of file
@@ -21,6 +21,7 @@ UGObject::UGObject() :
     InitSize(ForceInit),
     MinSize(ForceInit),
     MaxSize(ForceInit),
+    ResourceHandle(0),
     Position(ForceInit),
     Size(ForceInit),
     RawSize(ForceInit),
@@ -66,6 +67,9 @@ void UGObject::SetPosition(const FVector2D& InPosition)
 
         UpdateGear(1);
 
+        if (Parent.IsValid())
+            Parent->ChildBoundsChanged(this);
+
         if (Parent.IsValid() && !Parent->IsA<UGList>())
         {
             Parent->SetBoundsChangedFlag();
@@ -147,6 +151,7 @@ void UGObject::SetSize(const FVector2D& InSize, bool bIgnorePivot)
         if (Parent.IsValid())
         {
             Relations->OnOwnerSizeChanged(Delta, bPivotAsAnchor || !bIgnorePivot);
+            Parent->ChildBoundsChanged(this);
             Parent->SetBoundsChangedFlag();
             if (Group.IsValid())
                 Group->SetBoundsChangedFlag();
@@ -243,6 +248,94 @@ void UGObject::SetAlpha(float InAlpha)
     }
 }
 
+bool UGObject::BeginStage()
+{
+    if (!FUIConfig::Config.CoalescePropertyWrites || !OnStage())
+        return false;
+
+    //gears are only updated from the flush if every staged write was made under the gear lock
+    if (!bStaged)
+    {
+        bStaged = true;
+        bStagedGearLocked = bGearLocked;
+        GetApp()->AddStagedObject(this);
+    }
+    else if (!bGearLocked)
+        bStagedGearLocked = false;
+
+    return true;
+}
+
+void UGObject::StageX(float InX)
+{
+    if (BeginStage())
+        StagedPosition = FVector2D(InX, StagedPosition.Get(Position).Y);
+    else
+        SetX(InX);
+}
+
+void UGObject::StageY(float InY)
+{
+    if (BeginStage())
+        StagedPosition = FVector2D(StagedPosition.Get(Position).X, InY);
+    else
+        SetY(InY);
+}
+
+void UGObject::StagePosition(const FVector2D& InPosition)
+{
+    if (BeginStage())
+        StagedPosition = InPosition;
+    else
+        SetPosition(InPosition);
+}
+
+void UGObject::StageSize(const FVector2D& InSize, bool bIgnorePivot)
+{
+    if (BeginStage())
+    {
+        StagedSize = InSize;
+        bStagedIgnorePivot = bIgnorePivot;
+    }
+    else
+        SetSize(InSize, bIgnorePivot);
+}
+
+void UGObject::StageAlpha(float InAlpha)
+{
+    if (BeginStage())
+        StagedAlpha = InAlpha;
+    else
+        SetAlpha(InAlpha);
+}
+
+void UGObject::FlushStagedProperties()
+{
+    if (!bStaged)
+        return;
+
+    bStaged = false;
+    TOptional<FVector2D> position = MoveTemp(StagedPosition);
+    TOptional<FVector2D> size = MoveTemp(StagedSize);
+    TOptional<float> alpha = MoveTemp(StagedAlpha);
+    StagedPosition.Reset();
+    StagedSize.Reset();
+    StagedAlpha.Reset();
+
+    bool bSavedGearLocked = bGearLocked;
+    bGearLocked = bStagedGearLocked;
+
+    //size first, with a pivot it also moves the object
+    if (size.IsSet())
+        SetSize(size.GetValue(), bStagedIgnorePivot);
+    if (position.IsSet())
+        SetPosition(position.GetValue());
+    if (alpha.IsSet())
+        SetAlpha(alpha.GetValue());
+
+    bGearLocked = bSavedGearLocked;
+}
+
 void UGObject::SetGrayed(bool InBGrayed)
 {
     if (bGrayed != InBGrayed)
@@ -2,31 +2,62 @@
 #include "UI/GObject.h"
 #include "UI/UIPackage.h"
 
-UGObject* FGObjectPool::GetObject(const FString & URL, UObject* WorldContextObject)
+int32 FGObjectPool::GetHandle(const FString& URL)
 {
-    FString URL2 = UUIPackage::NormalizeURL(URL);
-    if (URL2.Len() == 0)
+    if (URL.Len() == 0)
+        return 0;
+
+    TWeakPtr<FPackageItem>* Resolved = ResolvedURLs.Find(URL);
+    if (Resolved != nullptr)
+    {
+        //the package may have been removed since
+        TSharedPtr<FPackageItem> Item = Resolved->Pin();
+        if (Item.IsValid())
+            return Item->Handle;
+    }
+
+    TSharedPtr<FPackageItem> Item = UUIPackage::GetItemByURL(URL);
+    if (!Item.IsValid())
+        return 0;
+
+    ResolvedURLs.Add(URL, Item);
+    Pool.FindOrAdd(Item->Handle).Item = Item;
+    return Item->Handle;
+}
+
+UGObject* FGObjectPool::GetObject(const FString& URL, UObject* WorldContextObject)
+{
+    return GetObject(GetHandle(URL), WorldContextObject);
+}
+
+UGObject* FGObjectPool::GetObject(int32 Handle, UObject* WorldContextObject)
+{
+    FPoolEntry* Entry = Handle != 0 ? Pool.Find(Handle) : nullptr;
+    if (Entry == nullptr)
         return nullptr;
 
-    UGObject* ret;
-    TArray<UGObject*>& arr = Pool.FindOrAdd(URL2);
-    if (arr.Num() > 0)
-        ret = arr.Pop();
+    if (Entry->Objects.Num() > 0)
+        return Entry->Objects.Pop();
+
+    TSharedPtr<FPackageItem> Item = Entry->Item.Pin();
+    if (Item.IsValid())
+        return Item->Owner->CreateObject(Item, WorldContextObject);
     else
-        ret = UUIPackage::CreateObjectFromURL(URL2, WorldContextObject);
-    return ret;
+        return nullptr;
 }
 
 void FGObjectPool::ReturnObject(UGObject* Obj)
 {
-    TArray<UGObject*>& arr = Pool.FindOrAdd(Obj->GetResourceURL());
-    arr.Add(Obj);
+    FPoolEntry& Entry = Pool.FindOrAdd(Obj->GetResourceHandle());
+    if (!Entry.Item.IsValid())
+        Entry.Item = Obj->GetPackageItem();
+    Entry.Objects.Add(Obj);
 }
 
 void FGObjectPool::AddReferencedObjects(FReferenceCollector& Collector)
 {
     for (auto& Elem : Pool)
     {
-        Collector.AddReferencedObjects(Elem.Value);
+        Collector.AddReferencedObjects(Elem.Value.Objects);
     }
-}
\ No newline at end of file
+}
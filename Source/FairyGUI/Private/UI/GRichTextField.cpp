@@ -1,4 +1,6 @@
 #include "UI/GRichTextField.h"
+#include "Utils/UBBParser.h"
+#include "Widgets/STextField.h"
 
 UGRichTextField::UGRichTextField()
 {
@@ -6,4 +8,103 @@ UGRichTextField::UGRichTextField()
 
 UGRichTextField::~UGRichTextField()
 {
-}
\ No newline at end of file
+}
+
+const FString& UGRichTextField::GetText() const
+{
+    if (EvictedLength > 0)
+    {
+        UGRichTextField* This = const_cast<UGRichTextField*>(this);
+        This->Text.RemoveAt(0, EvictedLength, false);
+        This->EvictedLength = 0;
+    }
+
+    return Text;
+}
+
+void UGRichTextField::SetText(const FString& InText)
+{
+    SourceLengths.Reset();
+    FirstSource = 0;
+    EvictedLength = 0;
+
+    UGTextField::SetText(InText);
+
+    if (Content->IsVirtual())
+        SyncSources(Text.Len());
+}
+
+void UGRichTextField::SyncSources(int32 AddedLength)
+{
+    int32 NumSources = Content->GetSourceCount();
+    if (NumSources > SourceLengths.Num() - FirstSource)
+        SourceLengths.Add(AddedLength);
+
+    while (SourceLengths.Num() - FirstSource > NumSources)
+        EvictedLength += SourceLengths[FirstSource++];
+
+    //dropped text is removed once it is the larger part, so appending stays amortized O(appended)
+    if (FirstSource * 2 > SourceLengths.Num())
+    {
+        SourceLengths.RemoveAt(0, FirstSource, false);
+        FirstSource = 0;
+    }
+    if (EvictedLength * 2 > Text.Len())
+    {
+        Text.RemoveAt(0, EvictedLength, false);
+        EvictedLength = 0;
+    }
+}
+
+bool UGRichTextField::IsVirtual() const
+{
+    return Content->IsVirtual();
+}
+
+void UGRichTextField::SetVirtual(bool bInVirtual, int32 MaxParagraphs)
+{
+    bool bWasVirtual = Content->IsVirtual();
+    Content->SetVirtual(bInVirtual, MaxParagraphs);
+
+    if (bInVirtual && !bWasVirtual)
+    {
+        SourceLengths.Reset();
+        FirstSource = 0;
+        EvictedLength = 0;
+        SyncSources(Text.Len());
+    }
+    else if (bInVirtual)
+        SyncSources(0);
+    else if (bWasVirtual)
+    {
+        //Content only has the parsed text, the caller's text is parsed again
+        SourceLengths.Reset();
+        FirstSource = 0;
+        SetText(GetText());
+        return;
+    }
+
+    UpdateSize();
+}
+
+void UGRichTextField::AppendText(const FString& InText)
+{
+    if (!Content->IsVirtual())
+    {
+        SetText(Text + InText);
+        return;
+    }
+
+    if (!bFormatApplied)
+        ApplyFormat();
+
+    if (bUBBEnabled)
+        Content->AppendText(FUBBParser::DefaultParser.Parse(InText), true);
+    else
+        Content->AppendText(InText, bSupportHTML);
+
+    Text += InText;
+    SyncSources(InText.Len());
+
+    UpdateSize();
+}
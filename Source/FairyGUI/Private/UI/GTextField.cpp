@@ -23,6 +23,8 @@ void UGTextField::SetText(const FString& InText)
     if (!bFormatApplied)
         ApplyFormat();
     Text = InText;
+    if (!TemplateVars.IsSet())
+        CompiledTemplate.Reset();
 
     if (bUBBEnabled)
     {
@@ -107,67 +109,33 @@ UGTextField* UGTextField::SetVar(const FString& VarKey, const FString& VarValue)
     if (!TemplateVars.IsSet())
         TemplateVars.Emplace();
     TemplateVars.GetValue().Add(VarKey, VarValue);
+    CompiledTemplate.SetVar(VarKey, VarValue);
 
     return this;
 }
 
 void UGTextField::FlushVars()
 {
-    SetText(Text);
+    if (!CompiledTemplate.IsCompiled())
+    {
+        SetText(Text);
+        return;
+    }
+
+    FString parsedText;
+    CompiledTemplate.Emit(parsedText);
+    Content->SetText(parsedText, bUBBEnabled || bSupportHTML);
+
+    UpdateSize();
+    UpdateGear(6);
 }
 
 FString UGTextField::ParseTemplate(const FString& Template)
 {
-    int32 pos1 = 0, pos2 = 0;
-    int32 pos3;
-    FString tag;
-    FString value;
-    FString buffer;
-    TMap<FString, FString>& Vars = TemplateVars.GetValue();
-
-    while ((pos2 = Template.Find("{", ESearchCase::CaseSensitive, ESearchDir::FromStart, pos1)) != -1)
-    {
-        if (pos2 > 0 && Template[pos2 - 1] == '\\')
-        {
-            buffer.Append(*Template + pos1, pos2 - pos1 - 1);
-            buffer.AppendChar('{');
-            pos1 = pos2 + 1;
-            continue;
-        }
-
-        buffer.Append(*Template + pos1, pos2 - pos1);
-        pos1 = pos2;
-        pos2 = Template.Find("}", ESearchCase::CaseSensitive, ESearchDir::FromStart, pos1);
-        if (pos2 == -1)
-            break;
-
-        if (pos2 == pos1 + 1)
-        {
-            buffer.Append(*Template + pos1, 2);
-            pos1 = pos2 + 1;
-            continue;
-        }
-
-        tag = Template.Mid(pos1 + 1, pos2 - pos1 - 1);
-        if (tag.FindChar('=', pos3))
-        {
-            FString* ptr = Vars.Find(tag.Mid(0, pos3));
-            if (ptr != nullptr)
-                buffer.Append(*ptr);
-            else
-                buffer.Append(tag.Mid(pos3 + 1));
-        }
-        else
-        {
-            FString* ptr = Vars.Find(tag);
-            if (ptr != nullptr)
-                buffer.Append(*ptr);
-        }
-        pos1 = pos2 + 1;
-    }
-    if (pos1 < Template.Len())
-        buffer.Append(Template.Mid(pos1, Template.Len() - pos1));
+    CompiledTemplate.Compile(Template, TemplateVars.GetValue());
 
+    FString buffer;
+    CompiledTemplate.Emit(buffer);
     return buffer;
 }
 
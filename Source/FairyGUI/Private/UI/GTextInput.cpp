@@ -1,6 +1,5 @@
 #include "UI/GTextInput.h"
 #include "Utils/ByteBuffer.h"
-#include "Utils/UBBParser.h"
 #include "Widgets/STextInput.h"
 
 UGTextInput::UGTextInput()
@@ -23,19 +22,26 @@ UGTextInput::~UGTextInput()
 
 }
 
-TSharedRef<SMultiLineEditableText> UGTextInput::GetInputWidget() const
+TSharedPtr<SMultiLineEditableText> UGTextInput::GetInputWidget() const
 {
-    return StaticCastSharedRef<SMultiLineEditableText>(Content->Widget);
+    Content->GetWidget();
+    return Content->Widget;
+}
+
+TSharedRef<SWidget> UGTextInput::GetEditingWidget() const
+{
+    return Content->GetWidget();
 }
 
 void UGTextInput::SetText(const FString& InText)
 {
-    Content->Widget->SetText(FText::FromString(InText));
+    Text = InText;
+    Content->SetText(InText);
 }
 
 bool UGTextInput::IsSingleLine() const
 {
-    return false;
+    return Content->IsSingleLine();
 }
 
 void UGTextInput::SetSingleLine(bool bFlag)
@@ -55,7 +61,7 @@ void UGTextInput::ApplyFormat()
 
 void UGTextInput::SetPrompt(const FString& InPrompt)
 {
-    Content->Widget->SetHintText(FText::FromString(FUBBParser::DefaultParser.Parse(InPrompt, true)));
+    Content->SetPrompt(InPrompt);
 }
 
 void UGTextInput::SetPassword(bool bInPassword)
@@ -70,11 +76,12 @@ void UGTextInput::SetKeyboardType(int32 InKeyboardType)
 
 void UGTextInput::SetMaxLength(int32 InMaxLength)
 {
+    Content->SetMaxLength(InMaxLength);
 }
 
 void UGTextInput::SetRestrict(const FString& InRestrict)
 {
-
+    Content->SetRestrict(InRestrict);
 }
 
 void UGTextInput::NotifyTextChanged(const FText& InText)
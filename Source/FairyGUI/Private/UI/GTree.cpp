@@ -21,10 +21,12 @@ UGTree::~UGTree()
 UGTreeNode* UGTree::GetSelectedNode() const
 {
     int32 i = GetSelectedIndex();
-    if (i != -1)
-        return GetChildAt(i)->TreeNode;
-    else
+    if (i == -1)
         return nullptr;
+    else if (bVirtualTree)
+        return VisibleRows.IsValidIndex(i) ? VisibleRows[i] : nullptr;
+    else
+        return GetChildAt(i)->TreeNode;
 }
 
 void UGTree::GetSelectedNodes(TArray<UGTreeNode*>& Result) const
@@ -33,8 +35,13 @@ void UGTree::GetSelectedNodes(TArray<UGTreeNode*>& Result) const
     GetSelection(ids);
     for (auto& it : ids)
     {
-        UGTreeNode* Node = GetChildAt(it)->TreeNode;
-        Result.Add(Node);
+        if (bVirtualTree)
+        {
+            if (VisibleRows.IsValidIndex(it))
+                Result.Add(VisibleRows[it]);
+        }
+        else
+            Result.Add(GetChildAt(it)->TreeNode);
     }
 }
 
@@ -46,28 +53,43 @@ void UGTree::SelectNode(UGTreeNode* Node, bool bScrollItToView)
         ParentNode->SetExpaned(true);
         ParentNode = ParentNode->GetParent();
     }
-    if (Node->Cell != nullptr)
+    if (bVirtualTree)
+    {
+        int32 row = GetRow(Node);
+        if (row != INDEX_NONE)
+            AddSelection(row, bScrollItToView);
+    }
+    else if (Node->Cell != nullptr)
         AddSelection(GetChildIndex(Node->Cell), bScrollItToView);
 }
 
 void UGTree::UnselectNode(UGTreeNode* Node)
 {
-    if (Node->Cell != nullptr)
+    if (bVirtualTree)
+    {
+        int32 row = GetRow(Node);
+        if (row != INDEX_NONE)
+            RemoveSelection(row);
+    }
+    else if (Node->Cell != nullptr)
         RemoveSelection(GetChildIndex(Node->Cell));
 }
 
 void UGTree::ExpandAll(UGTreeNode* FolderNode)
 {
+    BeginUpdate();
     FolderNode->SetExpaned(true);
     for (auto& it : FolderNode->Children)
     {
         if (it->IsFolder())
             ExpandAll(it);
     }
+    EndUpdate();
 }
 
 void UGTree::CollapseAll(UGTreeNode* FolderNode)
 {
+    BeginUpdate();
     if (FolderNode != RootNode)
         FolderNode->SetExpaned(false);
     for (auto& it : FolderNode->Children)
@@ -75,6 +97,256 @@ void UGTree::CollapseAll(UGTreeNode* FolderNode)
         if (it->IsFolder())
             CollapseAll(it);
     }
+    EndUpdate();
+}
+
+void UGTree::EndUpdate()
+{
+    verifyf(UpdateLockCount > 0, TEXT("EndUpdate without BeginUpdate"));
+
+    UpdateLockCount--;
+    if (UpdateLockCount == 0 && bRowsDirty)
+        RefreshRows();
+}
+
+void UGTree::RefreshRows()
+{
+    bRowsDirty = false;
+
+    TArray<UGTreeNode*> rows;
+    CollectVisibleRows(RootNode, rows);
+
+    if (bVirtualTree)
+    {
+        TArray<UGTreeNode*> selected;
+        GetSelectedNodes(selected);
+
+        for (auto& it : VisibleRows)
+        {
+            if (it->GetTree() != this && it->Cell != nullptr)
+            {
+                if (it->Cell->TreeNode == it)
+                    it->Cell->TreeNode = nullptr;
+                it->Cell = nullptr;
+            }
+        }
+        PendingRenderNodes.Reset();
+
+        VisibleRows = MoveTemp(rows);
+        NumberedRows = 0;
+        ApplyVisibleRows(selected);
+        return;
+    }
+
+    //folders that already had a cell only need their state refreshed
+    for (auto& it : PendingRenderNodes)
+    {
+        if (it->GetTree() != this || it->Cell == nullptr)
+            continue;
+
+        TreeNodeRenderer.ExecuteIfBound(it, it->Cell);
+
+        UGController* cc = it->Cell->GetController("expanded");
+        if (cc != nullptr)
+            cc->SetSelectedIndex(it->IsExpanded() ? 1 : 0);
+    }
+    PendingRenderNodes.Reset();
+
+    TSet<UGObject*> cells;
+    cells.Reserve(rows.Num());
+    for (auto& it : rows)
+    {
+        if (it->Cell == nullptr)
+            CreateCell(it);
+        cells.Add(it->Cell);
+    }
+
+    for (int32 i = NumChildren() - 1; i >= 0; i--)
+    {
+        if (!cells.Contains(GetChildAt(i)))
+            RemoveChildAt(i);
+    }
+
+    int32 cnt = rows.Num();
+    for (int32 i = 0; i < cnt; i++)
+    {
+        UGComponent* Cell = rows[i]->Cell;
+        if (i >= NumChildren() || GetChildAt(i) != Cell)
+            AddChildAt(Cell, i);
+    }
+}
+
+void UGTree::SetVirtualTree()
+{
+    if (bVirtualTree)
+        return;
+
+    //cells created so far go back to the pool, from now on they are bound to rows on demand
+    TArray<UGTreeNode*> nodes;
+    CollectVisibleRows(RootNode, nodes);
+    for (auto& it : nodes)
+    {
+        if (it->Cell != nullptr)
+        {
+            it->Cell->TreeNode = nullptr;
+            it->Cell = nullptr;
+        }
+    }
+
+    bVirtualTree = true;
+    ItemRenderer = FListItemRenderer::CreateUObject(this, &UGTree::RenderVirtualRow);
+    ItemProvider = FListItemProvider::CreateUObject(this, &UGTree::GetVirtualRowURL);
+    SetVirtual();
+
+    VisibleRows = MoveTemp(nodes);
+    NumberedRows = 0;
+    SetNumItems(VisibleRows.Num());
+}
+
+bool UGTree::IsChildrenShown(const UGTreeNode* FolderNode) const
+{
+    if (FolderNode == RootNode)
+        return true;
+    if (!FolderNode->bExpanded)
+        return false;
+
+    if (bVirtualTree)
+    {
+        for (UGTreeNode* p = FolderNode->GetParent(); p != nullptr && p != RootNode; p = p->GetParent())
+        {
+            if (!p->bExpanded)
+                return false;
+        }
+        return true;
+    }
+    else
+        return FolderNode->Cell != nullptr && FolderNode->Cell->GetParent() != nullptr;
+}
+
+void UGTree::RenderVirtualRow(int32 Index, UGObject* Obj)
+{
+    UGComponent* Child = Obj->As<UGComponent>();
+    UGTreeNode* Node = VisibleRows[Index];
+
+    if (Child->TreeNode != nullptr && Child->TreeNode != Node && Child->TreeNode->Cell == Child)
+        Child->TreeNode->Cell = nullptr;
+    if (Node->Cell != nullptr && Node->Cell != Child && Node->Cell->TreeNode == Node)
+        Node->Cell->TreeNode = nullptr;
+    Child->TreeNode = Node;
+    Node->Cell = Child;
+
+    UGObject* IndentObj = Child->GetChild("indent");
+    if (IndentObj != nullptr)
+        IndentObj->SetWidth((Node->Level - 1) * Indent);
+
+    UGController* cc;
+
+    cc = Child->GetController("expanded");
+    if (cc != nullptr)
+    {
+        if (!cc->OnChanged().IsBoundToObject(this))
+            cc->OnChanged().AddUObject(this, &UGTree::OnExpandedStateChanged);
+        cc->SetSelectedIndex(Node->IsExpanded() ? 1 : 0);
+    }
+
+    cc = Child->GetController("leaf");
+    if (cc != nullptr)
+        cc->SetSelectedIndex(Node->IsFolder() ? 0 : 1);
+
+    if (Node->IsFolder())
+        Child->OnTouchBegin.AddUniqueDynamic(this, &UGTree::OnCellTouchBegin);
+
+    TreeNodeRenderer.ExecuteIfBound(Node, Child);
+}
+
+FString UGTree::GetVirtualRowURL(int32 Index)
+{
+    return VisibleRows[Index]->ResourceURL;
+}
+
+void UGTree::CollectVisibleRows(UGTreeNode* FolderNode, TArray<UGTreeNode*>& OutRows) const
+{
+    for (auto& it : FolderNode->Children)
+    {
+        OutRows.Add(it);
+        if (it->IsFolder() && it->IsExpanded())
+            CollectVisibleRows(it, OutRows);
+    }
+}
+
+int32 UGTree::GetRow(UGTreeNode* Node)
+{
+    //rows are numbered lazily, a splice only invalidates the rows from its position on
+    if (Node->Row < NumberedRows && VisibleRows[Node->Row] == Node)
+        return Node->Row;
+
+    if (NumberedRows < VisibleRows.Num())
+    {
+        for (int32 i = NumberedRows; i < VisibleRows.Num(); i++)
+            VisibleRows[i]->Row = i;
+        NumberedRows = VisibleRows.Num();
+
+        if (VisibleRows.IsValidIndex(Node->Row) && VisibleRows[Node->Row] == Node)
+            return Node->Row;
+    }
+
+    return INDEX_NONE;
+}
+
+int32 UGTree::GetInsertRowForNode(UGTreeNode* Node)
+{
+    //the rows of a shown node and its descendants are contiguous, their number is kept on the node
+    UGTreeNode* PrevNode = Node->GetPrevSibling();
+    if (PrevNode != nullptr)
+    {
+        int32 row = GetRow(PrevNode);
+        return row != INDEX_NONE ? row + PrevNode->GetRowCount() : VisibleRows.Num();
+    }
+
+    PrevNode = Node->GetParent();
+    if (PrevNode == RootNode)
+        return 0;
+
+    int32 row = GetRow(PrevNode);
+    return row != INDEX_NONE ? row + 1 : VisibleRows.Num();
+}
+
+void UGTree::UnlinkRows(int32 Row, int32 Count)
+{
+    for (int32 i = Row; i < Row + Count; i++)
+    {
+        UGTreeNode* Node = VisibleRows[i];
+        if (Node->Cell != nullptr)
+        {
+            if (Node->Cell->TreeNode == Node)
+                Node->Cell->TreeNode = nullptr;
+            Node->Cell = nullptr;
+        }
+    }
+}
+
+void UGTree::SpliceRows(int32 Row, int32 RemoveCount, const TArray<UGTreeNode*>& Rows)
+{
+    UnlinkRows(Row, RemoveCount);
+    VisibleRows.RemoveAt(Row, RemoveCount, false);
+    VisibleRows.Insert(Rows, Row);
+    NumberedRows = FMath::Min(NumberedRows, Row);
+
+    SpliceVirtualItems(Row, RemoveCount, Rows.Num());
+}
+
+void UGTree::ApplyVisibleRows(const TArray<UGTreeNode*>& SelectedNodes)
+{
+    SetNumItems(VisibleRows.Num());
+
+    //selection is kept by row in the virtual list, move it along with the nodes
+    ClearSelection();
+    for (auto& it : SelectedNodes)
+    {
+        int32 row = GetRow(it);
+        if (row != INDEX_NONE)
+            AddSelection(row, false);
+    }
 }
 
 void UGTree::CreateCell(UGTreeNode* Node)
@@ -111,6 +383,22 @@ void UGTree::CreateCell(UGTreeNode* Node)
 
 void UGTree::AfterInserted(UGTreeNode* Node)
 {
+    if (UpdateLockCount > 0)
+    {
+        bRowsDirty = true;
+        return;
+    }
+
+    if (bVirtualTree)
+    {
+        TArray<UGTreeNode*> rows;
+        rows.Add(Node);
+        if (Node->IsFolder() && Node->IsExpanded())
+            CollectVisibleRows(Node, rows);
+        SpliceRows(GetInsertRowForNode(Node), 0, rows);
+        return;
+    }
+
     if (Node->Cell == nullptr)
         CreateCell(Node);
 
@@ -148,11 +436,67 @@ int32 UGTree::GetInsertIndexForNode(UGTreeNode* Node)
 
 void UGTree::AfterRemoved(UGTreeNode* Node)
 {
+    if (UpdateLockCount > 0 && bVirtualTree)
+    {
+        bRowsDirty = true;
+        return;
+    }
+
+    if (bVirtualTree)
+    {
+        int32 row = GetRow(Node);
+        if (row != INDEX_NONE)
+            SpliceRows(row, Node->GetRowCount(), TArray<UGTreeNode*>());
+        return;
+    }
+
     RemoveNode(Node);
 }
 
 void UGTree::AfterExpanded(UGTreeNode* Node)
 {
+    if (UpdateLockCount > 0)
+    {
+        if (Node != RootNode)
+        {
+            OnTreeNodeWillExpand.ExecuteIfBound(Node, true);
+            PendingRenderNodes.Add(Node);
+        }
+        bRowsDirty = true;
+        return;
+    }
+
+    if (bVirtualTree)
+    {
+        if (Node != RootNode)
+            OnTreeNodeWillExpand.ExecuteIfBound(Node, true);
+
+        if (Node == RootNode || IsChildrenShown(Node))
+        {
+            if (Node == RootNode)
+            {
+                TArray<UGTreeNode*> selected;
+                GetSelectedNodes(selected);
+
+                VisibleRows.Reset();
+                CollectVisibleRows(RootNode, VisibleRows);
+                NumberedRows = 0;
+                ApplyVisibleRows(selected);
+            }
+            else
+            {
+                int32 row = GetRow(Node);
+                if (row != INDEX_NONE)
+                {
+                    TArray<UGTreeNode*> rows;
+                    CollectVisibleRows(Node, rows);
+                    SpliceRows(row + 1, 0, rows);
+                }
+            }
+        }
+        return;
+    }
+
     if (Node == RootNode)
     {
         CheckChildren(RootNode, 0);
@@ -176,6 +520,32 @@ void UGTree::AfterExpanded(UGTreeNode* Node)
 
 void UGTree::AfterCollapsed(UGTreeNode* Node)
 {
+    if (UpdateLockCount > 0)
+    {
+        if (Node != RootNode)
+        {
+            OnTreeNodeWillExpand.ExecuteIfBound(Node, false);
+            PendingRenderNodes.Add(Node);
+        }
+        bRowsDirty = true;
+        return;
+    }
+
+    if (bVirtualTree)
+    {
+        if (Node == RootNode)
+            return;
+
+        OnTreeNodeWillExpand.ExecuteIfBound(Node, false);
+
+        //the node is collapsed already, its hidden rows are still in the list.
+        //The row itself is refreshed too, so its expanded controller follows the node
+        int32 row = GetRow(Node);
+        if (row != INDEX_NONE)
+            SpliceRows(row + 1, Node->DescendantRows, TArray<UGTreeNode*>());
+        return;
+    }
+
     if (Node == RootNode)
     {
         CheckChildren(RootNode, 0);
@@ -199,6 +569,32 @@ void UGTree::AfterCollapsed(UGTreeNode* Node)
 
 void UGTree::AfterMoved(UGTreeNode* Node)
 {
+    if (UpdateLockCount > 0)
+    {
+        bRowsDirty = true;
+        return;
+    }
+
+    if (bVirtualTree)
+    {
+        int32 row = GetRow(Node);
+        if (row == INDEX_NONE)
+            return;
+
+        int32 cnt = Node->GetRowCount();
+        TArray<UGTreeNode*> rows(VisibleRows.GetData() + row, cnt);
+        VisibleRows.RemoveAt(row, cnt, false);
+        NumberedRows = FMath::Min(NumberedRows, row);
+
+        int32 insertRow = GetInsertRowForNode(Node);
+        VisibleRows.Insert(rows, insertRow);
+        NumberedRows = FMath::Min(NumberedRows, insertRow);
+
+        //the selection and sizes move with the rows
+        MoveVirtualItems(row, cnt, insertRow);
+        return;
+    }
+
     int32 startIndex = GetChildIndex(Node->Cell);
     int32 endIndex;
     if (Node->IsFolder())
@@ -298,13 +694,15 @@ void UGTree::RemoveNode(UGTreeNode* Node)
 void UGTree::OnCellTouchBegin(UEventContext* Context)
 {
     UGTreeNode* Node = Context->GetSender()->TreeNode;
-    bExpandedStatusInEvt = Node->IsExpanded();
+    if (Node != nullptr)
+        bExpandedStatusInEvt = Node->IsExpanded();
 }
 
 void UGTree::OnExpandedStateChanged(UGController* Controller)
 {
     UGTreeNode* Node = Cast<UGObject>(Controller->GetOuter())->TreeNode;
-    Node->SetExpaned(Controller->GetSelectedIndex() == 1);
+    if (Node != nullptr)
+        Node->SetExpaned(Controller->GetSelectedIndex() == 1);
 }
 
 void UGTree::DispatchItemEvent(UGObject* Obj, UEventContext* Context)
@@ -38,6 +38,9 @@ void UGTreeNode::SetExpaned(bool bInExpanded)
     if (bExpanded != bInExpanded)
     {
         bExpanded = bInExpanded;
+        if (Parent.IsValid())
+            Parent->ChangeDescendantRows(bExpanded ? DescendantRows : -DescendantRows);
+
         if (Tree.IsValid())
         {
             if (bExpanded)
@@ -102,9 +105,11 @@ UGTreeNode* UGTreeNode::AddChildAt(UGTreeNode* Child, int32 Index)
         else
             Children.Insert(Child, Index);
 
+        ChangeDescendantRows(Child->GetRowCount());
+
         Child->Level = Level + 1;
         Child->SetTree(Tree.Get());
-        if ((Tree.IsValid() && this == Tree->GetRootNode()) || (Cell != nullptr && Cell->GetParent() != nullptr && bExpanded))
+        if (Tree.IsValid() && Tree->IsChildrenShown(this))
             Tree->AfterInserted(Child);
     }
     return Child;
@@ -133,6 +138,7 @@ void UGTreeNode::RemoveChildAt(int32 Index)
     }
 
     Children.RemoveAt(Index);
+    ChangeDescendantRows(-Child->GetRowCount());
 }
 
 void UGTreeNode::RemoveChildren(int32 BeginIndex, int32 EndIndex)
@@ -200,7 +206,7 @@ void UGTreeNode::SetChildIndex(UGTreeNode* Child, int32 Index)
 
     Children.RemoveAt(OldIndex);
     Children.Insert(Child, Index);
-    if ((Tree.IsValid() && this == Tree->RootNode) || (Cell != nullptr && Cell->GetParent() != nullptr && bExpanded))
+    if (Tree.IsValid() && Tree->IsChildrenShown(this))
         Tree->AfterMoved(Child);
 }
 
@@ -229,6 +235,17 @@ int32 UGTreeNode::NumChildren() const
     return Children.Num();
 }
 
+void UGTreeNode::ChangeDescendantRows(int32 Delta)
+{
+    //a collapsed folder hides the change from its ancestors
+    for (UGTreeNode* Node = this; Node != nullptr; Node = Node->GetParent())
+    {
+        Node->DescendantRows += Delta;
+        if (!Node->bExpanded)
+            break;
+    }
+}
+
 void UGTreeNode::SetTree(UGTree* InTree)
 {
     Tree = InTree;
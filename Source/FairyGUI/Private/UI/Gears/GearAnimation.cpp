@@ -32,14 +32,14 @@ void FGearAnimation::AddStatus(const FString& PageID, FByteBuffer* Buffer)
     if (PageID.IsEmpty())
         Default = Value;
     else
-        Storage.Add(PageID, MoveTemp(Value));
+        Storage.Add(GetPageIndex(PageID), MoveTemp(Value));
 }
 
 void FGearAnimation::Apply()
 {
     Owner->bGearLocked = true;
 
-    FValue* Value = Storage.Find(Controller->GetSelectedPageID());
+    FValue* Value = Storage.Find(Controller->GetSelectedIndex());
     if (Value == nullptr)
         Value = &Default;
 
@@ -54,5 +54,5 @@ void FGearAnimation::UpdateState()
     FValue Value;
     Value.bPlaying = Owner->GetProp<bool>(EObjectPropID::Playing);
     Value.Frame = Owner->GetProp<int32>(EObjectPropID::Frame);
-    Storage.Add(Controller->GetSelectedPageID(), MoveTemp(Value));
+    Storage.Add(Controller->GetSelectedIndex(), MoveTemp(Value));
 }
\ No newline at end of file
@@ -10,6 +10,7 @@
 #include "UI/Gears/GearText.h"
 #include "UI/Gears/GearXY.h"
 #include "UI/GComponent.h"
+#include "UI/GController.h"
 #include "Utils/ByteBuffer.h"
 
 bool FGearBase::bDisableAllTweenEffect = false;
@@ -77,7 +78,10 @@ void FGearBase::SetController(UGController* InController)
     {
         Controller = InController;
         if (Controller != nullptr)
+        {
+            Controller->AddSubscriber(Owner);
             Init();
+        }
     }
 }
 
@@ -93,6 +97,11 @@ void FGearBase::Init()
 {
 }
 
+int32 FGearBase::GetPageIndex(const FString& PageID) const
+{
+    return Controller != nullptr ? Controller->GetPageIndexByID(PageID) : INDEX_NONE;
+}
+
 void FGearBase::AddStatus(const FString& PageID, FByteBuffer* Buffer)
 {
 }
@@ -112,6 +121,7 @@ void FGearBase::UpdateFromRelations(const FVector2D& Delta)
 void FGearBase::Setup(FByteBuffer* Buffer)
 {
     Controller = Owner->GetParent()->GetControllerAt(Buffer->ReadShort());
+    Controller->AddSubscriber(Owner);
     Init();
 
     int32 Count = Buffer->ReadShort();
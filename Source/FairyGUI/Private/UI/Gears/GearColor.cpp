@@ -33,12 +33,12 @@ void FGearColor::AddStatus(const FString& PageID, FByteBuffer* Buffer)
     if (PageID.IsEmpty())
         Default = Value;
     else
-        Storage.Add(PageID, MoveTemp(Value));
+        Storage.Add(GetPageIndex(PageID), MoveTemp(Value));
 }
 
 void FGearColor::Apply()
 {
-    FValue* Value = Storage.Find(Controller->GetSelectedPageID());
+    FValue* Value = Storage.Find(Controller->GetSelectedIndex());
     if (Value == nullptr)
         Value = &Default;
 
@@ -109,5 +109,5 @@ void FGearColor::UpdateState()
     FValue Value;
     Value.Color = Owner->GetProp<FColor>(EObjectPropID::Color);
     Value.OutlineColor = Owner->GetProp<FColor>(EObjectPropID::OutlineColor);
-    Storage.Add(Controller->GetSelectedPageID(), MoveTemp(Value));
+    Storage.Add(Controller->GetSelectedIndex(), MoveTemp(Value));
 }
@@ -23,12 +23,12 @@ void FGearFontSize::AddStatus(const FString& PageID, FByteBuffer* Buffer)
     if (PageID.IsEmpty())
         Default = Buffer->ReadInt();
     else
-        Storage.Add(PageID, Buffer->ReadInt());
+        Storage.Add(GetPageIndex(PageID), Buffer->ReadInt());
 }
 
 void FGearFontSize::Apply()
 {
-    int32* Value = Storage.Find(Controller->GetSelectedPageID());
+    int32* Value = Storage.Find(Controller->GetSelectedIndex());
     if (Value == nullptr)
         Value = &Default;
 
@@ -39,5 +39,5 @@ void FGearFontSize::Apply()
 
 void FGearFontSize::UpdateState()
 {
-    Storage.Add(Controller->GetSelectedPageID(), Owner->GetProp<int32>(EObjectPropID::FontSize));
+    Storage.Add(Controller->GetSelectedIndex(), Owner->GetProp<int32>(EObjectPropID::FontSize));
 }
@@ -23,12 +23,12 @@ void FGearIcon::AddStatus(const FString& PageID, FByteBuffer* Buffer)
     if (PageID.IsEmpty())
         Default = Buffer->ReadS();
     else
-        Storage.Add(PageID, Buffer->ReadS());
+        Storage.Add(GetPageIndex(PageID), Buffer->ReadS());
 }
 
 void FGearIcon::Apply()
 {
-    FString* Value = Storage.Find(Controller->GetSelectedPageID());
+    FString* Value = Storage.Find(Controller->GetSelectedIndex());
     if (Value == nullptr)
         Value = &Default;
 
@@ -39,5 +39,5 @@ void FGearIcon::Apply()
 
 void FGearIcon::UpdateState()
 {
-    Storage.Add(Controller->GetSelectedPageID(), Owner->GetIcon());
+    Storage.Add(Controller->GetSelectedIndex(), Owner->GetIcon());
 }
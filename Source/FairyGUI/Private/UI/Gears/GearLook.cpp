@@ -42,12 +42,12 @@ void FGearLook::AddStatus(const FString& PageID, FByteBuffer* Buffer)
     if (PageID.IsEmpty())
         Default = Value;
     else
-        Storage.Add(PageID, MoveTemp(Value));
+        Storage.Add(GetPageIndex(PageID), MoveTemp(Value));
 }
 
 void FGearLook::Apply()
 {
-    FValue* Value = Storage.Find(Controller->GetSelectedPageID());
+    FValue* Value = Storage.Find(Controller->GetSelectedIndex());
     if (Value == nullptr)
         Value = &Default;
 
@@ -101,7 +101,7 @@ void FGearLook::OnTweenUpdate(FGTweener* Tweener)
     Owner->bGearLocked = true;
 
     if ((flag & 1) != 0)
-        Owner->SetAlpha(Tweener->Value.X);
+        Owner->StageAlpha(Tweener->Value.X);
     if ((flag & 2) != 0)
         Owner->SetRotation(Tweener->Value.Y);
     Owner->bGearLocked = false;
@@ -125,5 +125,5 @@ void FGearLook::UpdateState()
     Value.Rotation = Owner->GetRotation();
     Value.bGrayed = Owner->IsGrayed();
     Value.bTouchable = Owner->IsTouchable();
-    Storage.Add(Controller->GetSelectedPageID(), MoveTemp(Value));
+    Storage.Add(Controller->GetSelectedIndex(), MoveTemp(Value));
 }
@@ -32,12 +32,12 @@ void FGearSize::AddStatus(const FString& PageID, FByteBuffer* Buffer)
     if (PageID.IsEmpty())
         Default = Value;
     else
-        Storage.Add(PageID, MoveTemp(Value));
+        Storage.Add(GetPageIndex(PageID), MoveTemp(Value));
 }
 
 void FGearSize::Apply()
 {
-    FVector4* Value = Storage.Find(Controller->GetSelectedPageID());
+    FVector4* Value = Storage.Find(Controller->GetSelectedIndex());
     if (Value == nullptr)
         Value = &Default;
 
@@ -83,7 +83,7 @@ void FGearSize::OnTweenUpdate(FGTweener* Tweener)
     int32 flag = Tweener->GetUserData().AsInt();
     Owner->bGearLocked = true;
     if ((flag & 1) != 0)
-        Owner->SetSize(Tweener->Value.GetVec2(), Owner->CheckGearController(1, Controller));
+        Owner->StageSize(Tweener->Value.GetVec2(), Owner->CheckGearController(1, Controller));
     if ((flag & 2) != 0)
         Owner->SetScale(FVector2D(Tweener->Value.Z, Tweener->Value.W));
     Owner->bGearLocked = false;
@@ -102,19 +102,19 @@ void FGearSize::OnTweenComplete()
 
 void FGearSize::UpdateState()
 {
-    Storage.Add(Controller->GetSelectedPageID(), FVector4(Owner->GetWidth(), Owner->GetHeight(),
+    Storage.Add(Controller->GetSelectedIndex(), FVector4(Owner->GetWidth(), Owner->GetHeight(),
         Owner->GetScaleX(), Owner->GetScaleY()));
 }
 
 void FGearSize::UpdateFromRelations(const FVector2D& Delta)
 {
-    if (Controller != nullptr && Storage.Num() > 0)
+    if (Controller != nullptr && !Storage.IsEmpty())
     {
-        for (auto It = Storage.CreateIterator(); It; ++It)
+        Storage.ForEach([&Delta](FVector4& Value)
         {
-            It->Value = FVector4(It->Value.X + Delta.X, It->Value.Y + Delta.Y,
-                It->Value.Z, It->Value.W);
-        }
+            Value.X += Delta.X;
+            Value.Y += Delta.Y;
+        });
         Default.X += Delta.X;
         Default.Y += Delta.Y;
 
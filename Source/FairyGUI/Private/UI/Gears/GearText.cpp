@@ -23,12 +23,12 @@ void FGearText::AddStatus(const FString& PageID, FByteBuffer* Buffer)
     if (PageID.IsEmpty())
         Default = Buffer->ReadS();
     else
-        Storage.Add(PageID, Buffer->ReadS());
+        Storage.Add(GetPageIndex(PageID), Buffer->ReadS());
 }
 
 void FGearText::Apply()
 {
-    FString* Value = Storage.Find(Controller->GetSelectedPageID());
+    FString* Value = Storage.Find(Controller->GetSelectedIndex());
     if (Value == nullptr)
         Value = &Default;
 
@@ -39,5 +39,5 @@ void FGearText::Apply()
 
 void FGearText::UpdateState()
 {
-    Storage.Add(Controller->GetSelectedPageID(), Owner->GetText());
+    Storage.Add(Controller->GetSelectedIndex(), Owner->GetText());
 }
@@ -34,19 +34,25 @@ void FGearXY::AddStatus(const FString& PageID, FByteBuffer* Buffer)
     if (PageID.IsEmpty())
         Default = Value;
     else
-        Storage.Add(PageID, MoveTemp(Value));
+        Storage.Add(GetPageIndex(PageID), MoveTemp(Value));
 }
 
 void FGearXY::AddExtStatus(const FString& PageID, FByteBuffer* Buffer)
 {
-    FVector4* Value = PageID.IsEmpty() ? &Default : Storage.Find(Controller->GetSelectedPageID());
+    FVector4* Value = PageID.IsEmpty() ? &Default : Storage.Find(GetPageIndex(PageID));
+    if (Value == nullptr)
+    {
+        Buffer->Skip(8);
+        return;
+    }
+
     Value->Z = Buffer->ReadFloat();
     Value->W = Buffer->ReadFloat();
 }
 
 void FGearXY::Apply()
 {
-    FVector4* Value = Storage.Find(Controller->GetSelectedPageID());
+    FVector4* Value = Storage.Find(Controller->GetSelectedIndex());
     if (Value == nullptr)
         Value = &Default;
 
@@ -101,7 +107,7 @@ void FGearXY::Apply()
 void FGearXY::OnTweenUpdate(FGTweener* Tweener)
 {
     Owner->bGearLocked = true;
-    Owner->SetPosition(Tweener->Value.GetVec2());
+    Owner->StagePosition(Tweener->Value.GetVec2());
     Owner->bGearLocked = false;
 }
 
@@ -118,7 +124,7 @@ void FGearXY::OnTweenComplete()
 
 void FGearXY::UpdateState()
 {
-    Storage.Add(Controller->GetSelectedPageID(), FVector4(
+    Storage.Add(Controller->GetSelectedIndex(), FVector4(
         Owner->GetX(),
         Owner->GetY(),
         Owner->GetX() / Owner->GetParent()->GetWidth(),
@@ -127,13 +133,13 @@ void FGearXY::UpdateState()
 
 void FGearXY::UpdateFromRelations(const FVector2D& Delta)
 {
-    if (Controller != nullptr && Storage.Num() > 0 && !bPositionsInPercent)
+    if (Controller != nullptr && !Storage.IsEmpty() && !bPositionsInPercent)
     {
-        for (auto It = Storage.CreateIterator(); It; ++It)
+        Storage.ForEach([&Delta](FVector4& Value)
         {
-            It->Value = FVector4(It->Value.X + Delta.X, It->Value.Y + Delta.Y,
-                It->Value.Z, It->Value.W);
-        }
+            Value.X += Delta.X;
+            Value.Y += Delta.Y;
+        });
         Default.X += Delta.X;
         Default.Y += Delta.Y;
 
@@ -5,13 +5,17 @@
 
 FPackageItem::FPackageItem() :
     Owner(nullptr),
+    Handle(0),
     Type(EPackageItemType::Unknown),
     ObjectType(EObjectType::Component),
     Size(0, 0),
     Texture(nullptr),
     bScaleByTile(false),
-    TileGridIndice(0)
+    TileGridIndice(0),
+    bTranslated(false)
 {
+    static int32 _gHandleCounter = 0;
+    Handle = ++_gHandleCounter;
 }
 
 void FPackageItem::Load()
@@ -426,6 +426,28 @@ float UScrollPane::GetScrollingPosY() const
     return FMath::Clamp(-Container->GetPosition().Y, 0.f, OverlapSize.Y);
 }
 
+FVector2D UScrollPane::GetScrollingVelocity() const
+{
+    FVector2D ret(0, 0);
+    if (Tweening != 0)
+    {
+        //derivative of the cubicOut ease
+        for (int32 i = 0; i < 2; i++)
+        {
+            float d = TweenDuration.Component(i);
+            if (TweenChange.Component(i) != 0 && d > 0)
+            {
+                float t = FMath::Min(TweenTime.Component(i) / d, 1.f) - 1;
+                ret.Component(i) = -TweenChange.Component(i) * 3 * t * t / d;
+            }
+        }
+    }
+    else if (bDragged)
+        ret = -Velocity;
+
+    return ret;
+}
+
 void UScrollPane::SetViewWidth(float Width)
 {
     Width = Width + Owner->Margin.Left + Owner->Margin.Right;
@@ -503,6 +525,13 @@ void UScrollPane::HandleControllerChanged(UGController* Controller)
     }
 }
 
+void UScrollPane::SetPageController(UGController* InController)
+{
+    PageController = InController;
+    if (PageController != nullptr)
+        PageController->AddSubscriber(Owner);
+}
+
 void UScrollPane::UpdatePageController()
 {
     if (PageController != nullptr && !PageController->bChanging)
@@ -1169,13 +1198,26 @@ void UScrollPane::StartTween(int32 Type)
 {
     TweenTime.Set(0, 0);
     Tweening = Type;
-    GWorld->GetTimerManager().SetTimer(TickTimerHandle,
-        FTimerDelegate::CreateUObject(this, &UScrollPane::TweenUpdate),
-        0.016f,
-        true);
+    if (FUIConfig::Config.FrameSyncedScrolling)
+    {
+        TweenStartSeconds = FPlatformTime::Seconds();
+        Owner->GetApp()->AddTickingScrollPane(this);
+    }
+    else
+        GWorld->GetTimerManager().SetTimer(TickTimerHandle,
+            FTimerDelegate::CreateUObject(this, &UScrollPane::OnTweenTimer),
+            0.016f,
+            true);
     UpdateScrollBarVisible();
 }
 
+void UScrollPane::StopTweenTick()
+{
+    if (TickTimerHandle.IsValid())
+        GWorld->GetTimerManager().ClearTimer(TickTimerHandle);
+    Owner->GetApp()->RemoveTickingScrollPane(this);
+}
+
 void UScrollPane::KillTween()
 {
     if (Tweening == 1)
@@ -1186,7 +1228,7 @@ void UScrollPane::KillTween()
     }
 
     Tweening = 0;
-    GWorld->GetTimerManager().ClearTimer(TickTimerHandle);
+    StopTweenTick();
     Owner->DispatchEvent(FUIEvents::ScrollEnd);
 }
 
@@ -1239,12 +1281,22 @@ void UScrollPane::CheckRefreshBar()
     }
 }
 
-void UScrollPane::TweenUpdate()
+void UScrollPane::OnTweenTimer()
+{
+    TweenUpdate(GWorld->GetTimerManager().GetTimerElapsed(TickTimerHandle));
+}
+
+void UScrollPane::TweenUpdate(float DeltaTime)
 {
-    float dt = GWorld->GetTimerManager().GetTimerElapsed(TickTimerHandle);
+    //a tween started inside a frame only runs for the part of the frame after its start
+    if (TweenStartSeconds > 0)
+    {
+        DeltaTime = FMath::Min(DeltaTime, (float)(FPlatformTime::Seconds() - TweenStartSeconds));
+        TweenStartSeconds = 0;
+    }
 
-    float nx = RunTween(0, dt);
-    float ny = RunTween(1, dt);
+    float nx = RunTween(0, DeltaTime);
+    float ny = RunTween(1, DeltaTime);
 
     Container->SetPosition(FVector2D(nx, ny));
 
@@ -1262,7 +1314,7 @@ void UScrollPane::TweenUpdate()
     if (TweenChange.X == 0 && TweenChange.Y == 0)
     {
         Tweening = 0;
-        GWorld->GetTimerManager().ClearTimer(TickTimerHandle);
+        StopTweenTick();
 
         LoopCheckingCurrent();
 
@@ -1284,17 +1336,18 @@ float UScrollPane::RunTween(int32 Axis, float DeltaTime)
     float newValue;
     if (TweenChange.Component(Axis) != 0)
     {
+        float leftover = 0;
         TweenTime.Component(Axis) += DeltaTime;
         if (TweenTime.Component(Axis) >= TweenDuration.Component(Axis))
         {
+            //when synced to the frame, the time after the end is carried into a following bounce back
+            if (FUIConfig::Config.FrameSyncedScrolling)
+                leftover = TweenTime.Component(Axis) - TweenDuration.Component(Axis);
             newValue = TweenStart.Component(Axis) + TweenChange.Component(Axis);
             TweenChange.Component(Axis) = 0;
         }
         else
-        {
-            float ratio = sp_EaseFunc(TweenTime.Component(Axis), TweenDuration.Component(Axis));
-            newValue = TweenStart.Component(Axis) + (int32)(TweenChange.Component(Axis) * ratio);
-        }
+            newValue = GetTweenValue(Axis);
 
         float threshold1 = 0;
         float threshold2 = -OverlapSize.Component(Axis);
@@ -1326,6 +1379,14 @@ float UScrollPane::RunTween(int32 Axis, float DeltaTime)
                 TweenChange.Component(Axis) = threshold2 - newValue;
                 TweenStart.Component(Axis) = newValue;
             }
+            else
+                leftover = 0;
+
+            if (leftover > 0)
+            {
+                TweenTime.Component(Axis) = FMath::Min(leftover, TweenDuration.Component(Axis));
+                newValue = GetTweenValue(Axis);
+            }
         }
         else
         {
@@ -1347,6 +1408,16 @@ float UScrollPane::RunTween(int32 Axis, float DeltaTime)
     return newValue;
 }
 
+float UScrollPane::GetTweenValue(int32 Axis) const
+{
+    float ratio = sp_EaseFunc(TweenTime.Component(Axis), TweenDuration.Component(Axis));
+    //when synced to the frame the exact position at this frame is used, not a whole pixel step
+    if (FUIConfig::Config.FrameSyncedScrolling)
+        return TweenStart.Component(Axis) + TweenChange.Component(Axis) * ratio;
+    else
+        return TweenStart.Component(Axis) + (int32)(TweenChange.Component(Axis) * ratio);
+}
+
 void UScrollPane::OnTouchBegin(UEventContext* Context)
 {
     if (!bTouchEffect)
@@ -2,8 +2,12 @@
 #include "UI/GComponent.h"
 #include "UI/UIPackage.h"
 #include "UI/GController.h"
+#include "UI/UIConfig.h"
 #include "Utils/ByteBuffer.h"
 #include "Tween/GPath.h"
+#include "Tween/EaseManager.h"
+#include "Tween/TweenManager.h"
+#include "FairyApplication.h"
 
 const int32 OPTION_IGNORE_DISPLAY_CONTROLLER = 1;
 const int32 OPTION_AUTO_STOP_DISABLED = 2;
@@ -13,7 +17,6 @@ struct FAniData
 {
     int32 Frame;
     bool bPlaying;
-    bool bFlag;
 };
 
 struct FSoundData
@@ -26,16 +29,12 @@ struct FInnerTransData
 {
     FString Name;
     int32 PlayTimes;
-    UTransition* Instance;
-    float StopTime;
 };
 
 struct FShakeData
 {
     float Amplitude;
     float Duration;
-    FVector2D LastOffset;
-    FVector2D Offset;
 };
 
 struct FTransitionItemData
@@ -113,7 +112,6 @@ struct FTweenConfig
     TSharedPtr<FGPath> Path;
 
     FString EndLabel;
-    FSimpleDelegate EndHook;
 
     FTweenConfig();
 };
@@ -123,14 +121,14 @@ FTweenConfig::FTweenConfig() :
 {
 }
 
-struct FTransitionItem
+//What the package describes for an item, shared by all instances of the component
+struct FTransitionItemDef
 {
     float Time;
     FString TargetID;
     ETransitionActionType Type;
     TOptional<FTweenConfig> TweenConfig;
     FString Label;
-    FSimpleDelegate Hook;
 
     TOptional<FTransitionItemData> Data;
     TOptional<bool> VisibleData;
@@ -140,21 +138,12 @@ struct FTransitionItem
     TOptional<FShakeData> ShakeData;
     TOptional<FString> TextData;
 
-    //running properties
-    FGTweener* Tweener;
-    UGObject* Target;
-    uint32 DisplayLockToken;
-
-    FTransitionItem(ETransitionActionType aType);
-    ~FTransitionItem();
+    FTransitionItemDef(ETransitionActionType aType);
 };
 
-FTransitionItem::FTransitionItem(ETransitionActionType InType) :
+FTransitionItemDef::FTransitionItemDef(ETransitionActionType InType) :
     Time(0),
-    Type(InType),
-    Tweener(nullptr),
-    Target(nullptr),
-    DisplayLockToken(0)
+    Type(InType)
 {
     switch (InType)
     {
@@ -200,12 +189,286 @@ FTransitionItem::FTransitionItem(ETransitionActionType InType) :
     }
 }
 
+struct FTransitionDef
+{
+    FString Name;
+    int32 Options;
+    bool bAutoPlay;
+    int32 AutoPlayTimes;
+    float AutoPlayDelay;
+    float TotalDuration;
+    TArray<FTransitionItemDef> Items;
+
+    //baked lazily on the first baked play of any instance
+    TSharedPtr<FTransitionTimeline> Timeline;
+    bool bTimelineBuilt;
+
+    FTransitionDef();
+};
+
+FTransitionDef::FTransitionDef() :
+    Options(0),
+    bAutoPlay(false),
+    AutoPlayTimes(1),
+    AutoPlayDelay(0),
+    TotalDuration(0),
+    bTimelineBuilt(false)
+{
+}
+
+//Playback state of an item in one transition instance
+struct FTransitionItem
+{
+    const FTransitionItemDef* Def;
+    //private copy of the definition once this instance changes a value, target or duration
+    TUniquePtr<FTransitionItemDef> ModifiedDef;
+
+    FSimpleDelegate Hook;
+    FSimpleDelegate EndHook;
+    FTransitionItemData Data;
+    bool bAniFlag;
+    FVector2D ShakeLastOffset;
+    FVector2D ShakeOffset;
+    UTransition* TransInstance;
+    float TransStopTime;
+
+    FGTweener* Tweener;
+    UGObject* Target;
+    uint32 DisplayLockToken;
+
+    FTransitionItem();
+    ~FTransitionItem();
+
+    void Init(const FTransitionItemDef* InDef);
+    FTransitionItemDef& Modify();
+};
+
+FTransitionItem::FTransitionItem() :
+    Def(nullptr),
+    bAniFlag(false),
+    ShakeLastOffset(0, 0),
+    ShakeOffset(0, 0),
+    TransInstance(nullptr),
+    TransStopTime(-1),
+    Tweener(nullptr),
+    Target(nullptr),
+    DisplayLockToken(0)
+{
+}
+
 FTransitionItem::~FTransitionItem()
 {
     if (Tweener != nullptr)
         Tweener->Kill();
 }
 
+void FTransitionItem::Init(const FTransitionItemDef* InDef)
+{
+    Def = InDef;
+    if (Def->Data.IsSet())
+        Data = Def->Data.GetValue();
+}
+
+FTransitionItemDef& FTransitionItem::Modify()
+{
+    if (!ModifiedDef.IsValid())
+    {
+        ModifiedDef = MakeUnique<FTransitionItemDef>(*Def);
+        Def = ModifiedDef.Get();
+    }
+    return *ModifiedDef;
+}
+
+//One interpolation of a track, taken from a tween item
+struct FTimelineKey
+{
+    float Time;
+    float Duration;
+    EEaseType EaseType;
+    FVector4 StartValue;
+    FVector4 EndValue;
+    int32 ItemIndex;
+};
+
+//All tweens of one property of one target, ordered by time
+struct FTimelineTrack
+{
+    ETransitionActionType Type;
+    TArray<FTimelineKey> Keys;
+};
+
+//An instant action or a hook, fired once when the cursor passes its time
+struct FTimelineEvent
+{
+    float Time;
+    int32 ItemIndex;
+    bool bTweenEnd;
+};
+
+struct FTransitionTimeline
+{
+    float Duration;
+    TArray<FTimelineTrack> Tracks;
+    TArray<FTimelineEvent> Events;
+};
+
+static bool IsBakeable(const FTransitionItem* item)
+{
+    switch (item->Def->Type)
+    {
+    case ETransitionActionType::Animation:
+    case ETransitionActionType::Shake:
+    case ETransitionActionType::Transition:
+        return false;
+
+    default:
+        break;
+    }
+
+    if (!item->Def->TweenConfig.IsSet())
+        return true;
+
+    const FTweenConfig& config = item->Def->TweenConfig.GetValue();
+    if (config.Repeat != 0 || config.Path.IsValid())
+        return false;
+
+    switch (item->Def->Type)
+    {
+    case ETransitionActionType::XY:
+    case ETransitionActionType::Size:
+        //values that depend on the target or owner at start time are resolved by the tweener path only
+        return config.StartData.b1 && config.StartData.b2 && !config.StartData.b3
+            && config.EndData.b1 && config.EndData.b2 && !config.EndData.b3;
+
+    case ETransitionActionType::Scale:
+    case ETransitionActionType::Skew:
+    case ETransitionActionType::Alpha:
+    case ETransitionActionType::Rotation:
+    case ETransitionActionType::Color:
+    case ETransitionActionType::ColorFilter:
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+static TSharedPtr<FTransitionTimeline> BakeTimeline(const TArray<FTransitionItem*>& Items)
+{
+    for (auto& item : Items)
+    {
+        if (!IsBakeable(item))
+            return nullptr;
+    }
+
+    TSharedPtr<FTransitionTimeline> timeline = MakeShareable(new FTransitionTimeline());
+    timeline->Duration = 0;
+
+    TMap<TPair<FString, int32>, int32> trackIndexMap;
+    int32 cnt = Items.Num();
+    for (int32 i = 0; i < cnt; i++)
+    {
+        FTransitionItem* item = Items[i];
+        timeline->Events.Add({ item->Def->Time, i, false });
+
+        if (!item->Def->TweenConfig.IsSet())
+        {
+            timeline->Duration = FMath::Max(timeline->Duration, item->Def->Time);
+            continue;
+        }
+
+        const FTweenConfig& config = item->Def->TweenConfig.GetValue();
+        float endTime = item->Def->Time + config.Duration;
+        timeline->Events.Add({ endTime, i, true });
+        timeline->Duration = FMath::Max(timeline->Duration, endTime);
+
+        if (item->Def->Type == ETransitionActionType::ColorFilter) //not applied to the target
+            continue;
+
+        int32* trackIndexPtr = trackIndexMap.Find(TPair<FString, int32>(item->Def->TargetID, (int32)item->Def->Type));
+        int32 trackIndex;
+        if (trackIndexPtr != nullptr)
+            trackIndex = *trackIndexPtr;
+        else
+        {
+            trackIndex = timeline->Tracks.Num();
+            timeline->Tracks.AddDefaulted();
+            timeline->Tracks[trackIndex].Type = item->Def->Type;
+            trackIndexMap.Add(TPair<FString, int32>(item->Def->TargetID, (int32)item->Def->Type), trackIndex);
+        }
+
+        FTimelineKey key;
+        key.Time = item->Def->Time;
+        key.Duration = config.Duration;
+        key.EaseType = config.EaseType;
+        key.StartValue = config.StartData.GetVec4();
+        key.EndValue = config.EndData.GetVec4();
+        key.ItemIndex = i;
+        timeline->Tracks[trackIndex].Keys.Add(key);
+    }
+
+    for (auto& it : timeline->Tracks)
+        it.Keys.StableSort([](const FTimelineKey& a, const FTimelineKey& b) { return a.Time < b.Time; });
+    timeline->Events.StableSort([](const FTimelineEvent& a, const FTimelineEvent& b) { return a.Time < b.Time; });
+
+    return timeline;
+}
+
+static void ApplyTrackValue(ETransitionActionType Type, UGObject* Target, UGComponent* Owner, const FVector2D& OwnerBasePos, const FVector4& Value)
+{
+    Target->bGearLocked = true;
+
+    switch (Type)
+    {
+    case ETransitionActionType::XY:
+        if (Target == Owner)
+            Target->StagePosition(FVector2D(Value.X, Value.Y) + OwnerBasePos);
+        else
+            Target->StagePosition(FVector2D(Value.X, Value.Y));
+        break;
+
+    case ETransitionActionType::Size:
+        Target->StageSize(FVector2D(Value.X, Value.Y));
+        break;
+
+    case ETransitionActionType::Scale:
+        Target->SetScale(FVector2D(Value.X, Value.Y));
+        break;
+
+    case ETransitionActionType::Skew:
+        Target->SetSkew(FVector2D(Value.X, Value.Y));
+        break;
+
+    case ETransitionActionType::Alpha:
+        Target->StageAlpha(Value.X);
+        break;
+
+    case ETransitionActionType::Rotation:
+        Target->SetRotation(Value.X);
+        break;
+
+    case ETransitionActionType::Color:
+        Target->SetProp(EObjectPropID::Color, FNVariant(FColor(Value.X * 255.f, Value.Y * 255.f, Value.Z * 255.f, Value.W * 255.f)));
+        break;
+
+    default:
+        break;
+    }
+
+    Target->bGearLocked = false;
+}
+
+//the tweens of a transition belong to the application of its component, so they tick with that
+//game instance and are dropped with it
+static FTweenManager& GetTweenManager(UGComponent* Owner)
+{
+    UWorld* World = Owner->GetWorld();
+    if (World != nullptr && World->IsGameWorld())
+        return Owner->GetApp()->GetTweenManager();
+    else
+        return FTweenManager::Singleton;
+}
+
 UTransition::UTransition() :
     TotalTimes(0),
     TotalTasks(0),
@@ -218,7 +481,12 @@ UTransition::UTransition() :
     AutoPlayDelay(0),
     TimeScale(1),
     StartTime(0),
-    EndTime(0)
+    EndTime(0),
+    ItemStates(nullptr),
+    bItemsModified(false),
+    bTimelineBuilt(false),
+    NextEvent(0),
+    TimelinePlayCount(0)
 {
 
 }
@@ -227,9 +495,10 @@ UTransition::~UTransition()
 {
     if (DelayHandle.IsValid())
         FGTween::Kill(DelayHandle);
+    if (TimelineHandle.IsValid())
+        FGTween::Kill(TimelineHandle);
 
-    for (auto &it : Items)
-        delete it;
+    delete[] ItemStates;
 }
 
 void UTransition::Play(int32 InTimes, float InDelay, float InStartTime, float InEndTime, bool bInReverse, FSimpleDelegate InCompleteCallback)
@@ -250,52 +519,52 @@ void UTransition::Play(int32 InTimes, float InDelay, float InStartTime, float In
         FTransitionItem* item = Items[i];
         if (item->Target == nullptr)
         {
-            if (!item->TargetID.IsEmpty())
-                item->Target = Owner->GetChildByID(item->TargetID);
+            if (!item->Def->TargetID.IsEmpty())
+                item->Target = Owner->GetChildByID(item->Def->TargetID);
             else
                 item->Target = Owner;
         }
         else if (item->Target != Owner && item->Target->GetParent() != Owner) //maybe removed
             item->Target = nullptr;
 
-        if (item->Target != nullptr && item->Type == ETransitionActionType::Transition)
+        if (item->Target != nullptr && item->Def->Type == ETransitionActionType::Transition)
         {
-            UTransition* trans = Cast<UGComponent>(item->Target)->GetTransition(item->TransData->Name);
+            UTransition* trans = Cast<UGComponent>(item->Target)->GetTransition(item->Def->TransData->Name);
             if (trans == this)
                 trans = nullptr;
             if (trans != nullptr)
             {
-                if (item->TransData->PlayTimes == 0) //stop
+                if (item->Def->TransData->PlayTimes == 0) //stop
                 {
                     int32 j;
                     for (j = i - 1; j >= 0; j--)
                     {
                         FTransitionItem* item2 = Items[j];
-                        if (item2->Type == ETransitionActionType::Transition)
+                        if (item2->Def->Type == ETransitionActionType::Transition)
                         {
-                            if (item2->TransData->Instance == trans)
+                            if (item2->TransInstance == trans)
                             {
-                                item2->TransData->StopTime = item->Time - item2->Time;
+                                item2->TransStopTime = item->Def->Time - item2->Def->Time;
                                 break;
                             }
                         }
                     }
                     if (j < 0)
-                        item->TransData->StopTime = 0;
+                        item->TransStopTime = 0;
                     else
                         trans = nullptr; //no need to handle stop anymore
                 }
                 else
-                    item->TransData->StopTime = -1;
+                    item->TransStopTime = -1;
             }
-            item->TransData->Instance = trans;
+            item->TransInstance = trans;
         }
     }
 
     if (InDelay == 0)
         OnDelayedPlay();
     else
-        DelayHandle = FGTween::DelayedCall(InDelay)->OnComplete(FSimpleDelegate::CreateUObject(this, &UTransition::OnDelayedPlay))->GetHandle();
+        DelayHandle = GetTweenManager(Owner).CreateTween()->SetDelay(InDelay)->OnComplete(FSimpleDelegate::CreateUObject(this, &UTransition::OnDelayedPlay))->GetHandle();
 }
 
 void UTransition::ChangePlayTimes(int32 InTimes)
@@ -334,6 +603,17 @@ void UTransition::Stop(bool bSetToComplete, bool bProcessCallback)
     FSimpleDelegate func = CompleteCallback;
     CompleteCallback.Unbind();
 
+    if (PlayingTimeline.IsValid())
+    {
+        FGTween::Kill(TimelineHandle);
+
+        int32 playCount = TimelinePlayCount;
+        if (bSetToComplete)
+            UpdateTimeline(PlayingTimeline->Duration);
+        if (playCount == TimelinePlayCount) //not played again by a hook
+            PlayingTimeline.Reset();
+    }
+
     int32 cnt = Items.Num();
     if (bReversed)
     {
@@ -374,10 +654,10 @@ void UTransition::StopItem(FTransitionItem* item, bool bSetToComplete)
         item->Tweener->Kill(bSetToComplete);
         item->Tweener = nullptr;
 
-        if (item->Type == ETransitionActionType::Shake && !bSetToComplete)
+        if (item->Def->Type == ETransitionActionType::Shake && !bSetToComplete)
         {
             item->Target->bGearLocked = true;
-            item->Target->SetPosition(item->Target->GetPosition() - item->ShakeData->LastOffset);
+            item->Target->SetPosition(item->Target->GetPosition() - item->ShakeLastOffset);
             item->Target->bGearLocked = false;
         }
     }
@@ -390,6 +670,9 @@ void UTransition::SetPaused(bool bInPaused)
 
     bPaused = bInPaused;
     FGTweener* tweener = FGTween::GetTween(DelayHandle);
+    if (tweener != nullptr)
+        tweener->SetPaused(bPaused);
+    tweener = FGTween::GetTween(TimelineHandle);
     if (tweener != nullptr)
         tweener->SetPaused(bPaused);
 
@@ -398,20 +681,20 @@ void UTransition::SetPaused(bool bInPaused)
         if (item->Target == nullptr)
             continue;
 
-        if (item->Type == ETransitionActionType::Transition)
+        if (item->Def->Type == ETransitionActionType::Transition)
         {
-            if (item->TransData->Instance != nullptr)
-                item->TransData->Instance->SetPaused(bPaused);
+            if (item->TransInstance != nullptr)
+                item->TransInstance->SetPaused(bPaused);
         }
-        else if (item->Type == ETransitionActionType::Animation)
+        else if (item->Def->Type == ETransitionActionType::Animation)
         {
             if (bPaused)
             {
-                item->AniData->bFlag = item->Target->GetProp<bool>(EObjectPropID::Playing);
+                item->bAniFlag = item->Target->GetProp<bool>(EObjectPropID::Playing);
                 item->Target->SetProp(EObjectPropID::Playing, FNVariant(false));
             }
             else
-                item->Target->SetProp(EObjectPropID::Playing, FNVariant(item->AniData->bFlag));
+                item->Target->SetProp(EObjectPropID::Playing, FNVariant(item->bAniFlag));
         }
 
         if (item->Tweener != nullptr)
@@ -425,21 +708,26 @@ void UTransition::SetValue(const FString& InLabel, const TArray<FNVariant>& InVa
 
     for (auto& item : Items)
     {
-        if (item->Label == InLabel)
+        FTransitionItemDef* def;
+        if (item->Def->Label == InLabel)
         {
-            if (item->TweenConfig.IsSet())
-                Value = &item->TweenConfig->StartData;
-            else if (item->Data.IsSet())
-                Value = &item->Data.GetValue();
+            def = &item->Modify();
+            if (def->TweenConfig.IsSet())
+                Value = &def->TweenConfig->StartData;
+            else if (def->Data.IsSet())
+                Value = &item->Data;
         }
-        else if (item->TweenConfig.IsSet() && item->TweenConfig->EndLabel == InLabel)
+        else if (item->Def->TweenConfig.IsSet() && item->Def->TweenConfig->EndLabel == InLabel)
         {
-            Value = &item->TweenConfig->EndData;
+            def = &item->Modify();
+            Value = &def->TweenConfig->EndData;
         }
         else
             continue;
 
-        switch (item->Type)
+        OnItemsModified();
+
+        switch (def->Type)
         {
         case ETransitionActionType::XY:
         case ETransitionActionType::Size:
@@ -467,37 +755,37 @@ void UTransition::SetValue(const FString& InLabel, const TArray<FNVariant>& InVa
 
         case ETransitionActionType::Animation:
         {
-            item->AniData->Frame = InValues[0].AsInt();
+            def->AniData->Frame = InValues[0].AsInt();
             if (InValues.Num() > 1)
-                item->AniData->bPlaying = InValues[0].AsBool();
+                def->AniData->bPlaying = InValues[0].AsBool();
             break;
         }
 
         case ETransitionActionType::Visible:
-            item->VisibleData = InValues[0].AsBool();
+            def->VisibleData = InValues[0].AsBool();
             break;
 
         case ETransitionActionType::Sound:
         {
-            item->SoundData->URL = InValues[0].AsString();
+            def->SoundData->URL = InValues[0].AsString();
             if (InValues.Num() > 1)
-                item->SoundData->Volume = InValues[1].AsFloat();
+                def->SoundData->Volume = InValues[1].AsFloat();
             break;
         }
 
         case ETransitionActionType::Transition:
         {
-            item->TransData->Name = InValues[0].AsString();
+            def->TransData->Name = InValues[0].AsString();
             if (InValues.Num() > 1)
-                item->TransData->PlayTimes = InValues[1].AsInt();
+                def->TransData->PlayTimes = InValues[1].AsInt();
             break;
         }
 
         case ETransitionActionType::Shake:
         {
-            item->ShakeData->Amplitude = InValues[0].AsFloat();
+            def->ShakeData->Amplitude = InValues[0].AsFloat();
             if (InValues.Num() > 1)
-                item->ShakeData->Duration = InValues[1].AsFloat();
+                def->ShakeData->Duration = InValues[1].AsFloat();
             break;
         }
 
@@ -512,7 +800,7 @@ void UTransition::SetValue(const FString& InLabel, const TArray<FNVariant>& InVa
 
         case ETransitionActionType::Text:
         case ETransitionActionType::Icon:
-            item->TextData = InValues[0].AsString();
+            def->TextData = InValues[0].AsString();
             break;
         default:
             break;
@@ -524,14 +812,14 @@ void UTransition::SetHook(const FString& InLabel, FSimpleDelegate Callback)
 {
     for (auto& item : Items)
     {
-        if (item->Label == InLabel)
+        if (item->Def->Label == InLabel)
         {
             item->Hook = Callback;
             break;
         }
-        else if (item->TweenConfig.IsSet() && item->TweenConfig->EndLabel == InLabel)
+        else if (item->Def->TweenConfig.IsSet() && item->Def->TweenConfig->EndLabel == InLabel)
         {
-            item->TweenConfig->EndHook = Callback;
+            item->EndHook = Callback;
             break;
         }
     }
@@ -542,8 +830,8 @@ void UTransition::ClearHooks()
     for (auto& item : Items)
     {
         item->Hook.Unbind();
-        if (item->TweenConfig.IsSet())
-            item->TweenConfig->EndHook.Unbind();
+        if (item->Def->TweenConfig.IsSet())
+            item->EndHook.Unbind();
     }
 }
 
@@ -551,11 +839,11 @@ void UTransition::SetTarget(const FString& InLabel, UGObject* InTarget)
 {
     for (auto& item : Items)
     {
-        if (item->Label == InLabel)
+        if (item->Def->Label == InLabel)
         {
-
-            item->TargetID = InTarget->ID;
+            item->Modify().TargetID = InTarget->ID;
             item->Target = nullptr;
+            OnItemsModified();
         }
     }
 }
@@ -564,8 +852,11 @@ void UTransition::SetDuration(const FString& InLabel, float InDuration)
 {
     for (auto& item : Items)
     {
-        if (item->TweenConfig.IsSet() && item->Label == InLabel)
-            item->TweenConfig->Duration = InDuration;
+        if (item->Def->TweenConfig.IsSet() && item->Def->Label == InLabel)
+        {
+            item->Modify().TweenConfig->Duration = InDuration;
+            OnItemsModified();
+        }
     }
 }
 
@@ -573,12 +864,12 @@ float UTransition::GetLabelTime(const FString& InLabel) const
 {
     for (auto& item : Items)
     {
-        if (item->Label == InLabel)
+        if (item->Def->Label == InLabel)
         {
-            if (item->TweenConfig.IsSet())
-                return item->Time + item->TweenConfig->Duration;
+            if (item->Def->TweenConfig.IsSet())
+                return item->Def->Time + item->Def->TweenConfig->Duration;
             else
-                return item->Time;
+                return item->Def->Time;
         }
     }
 
@@ -591,16 +882,20 @@ void UTransition::SetTimeScale(float InTimeScale)
     {
         TimeScale = InTimeScale;
 
+        FGTweener* tweener = FGTween::GetTween(TimelineHandle);
+        if (tweener != nullptr)
+            tweener->SetTimeScale(InTimeScale);
+
         for (auto& item : Items)
         {
             if (item->Tweener != nullptr)
                 item->Tweener->SetTimeScale(InTimeScale);
-            else if (item->Type == ETransitionActionType::Transition)
+            else if (item->Def->Type == ETransitionActionType::Transition)
             {
-                if (item->TransData->Instance != nullptr)
-                    item->TransData->Instance->SetTimeScale(InTimeScale);
+                if (item->TransInstance != nullptr)
+                    item->TransInstance->SetTimeScale(InTimeScale);
             }
-            else if (item->Type == ETransitionActionType::Animation)
+            else if (item->Def->Type == ETransitionActionType::Animation)
             {
                 if (item->Target != nullptr)
                     item->Target->SetProp(EObjectPropID::TimeScale, FNVariant(InTimeScale));
@@ -617,22 +912,24 @@ void UTransition::UpdateFromRelations(const FString& TargetID, const FVector2D&
 
     for (auto& item : Items)
     {
-        if (item->Type == ETransitionActionType::XY && item->TargetID == TargetID)
+        if (item->Def->Type == ETransitionActionType::XY && item->Def->TargetID == TargetID)
         {
-            if (item->TweenConfig.IsSet())
+            if (item->Def->TweenConfig.IsSet())
             {
-                if (!item->TweenConfig->StartData.b3) {
-                    item->TweenConfig->StartData.f1 += Delta.X;
-                    item->TweenConfig->StartData.f2 += Delta.Y;
-                    item->TweenConfig->EndData.f1 += Delta.X;
-                    item->TweenConfig->EndData.f2 += Delta.Y;
+                if (!item->Def->TweenConfig->StartData.b3) {
+                    FTweenConfig& config = item->Modify().TweenConfig.GetValue();
+                    config.StartData.f1 += Delta.X;
+                    config.StartData.f2 += Delta.Y;
+                    config.EndData.f1 += Delta.X;
+                    config.EndData.f2 += Delta.Y;
+                    OnItemsModified();
                 }
             }
             else
             {
-                if (!item->Data->b3) {
-                    item->Data->f1 += Delta.X;
-                    item->Data->f2 += Delta.Y;
+                if (!item->Data.b3) {
+                    item->Data.f1 += Delta.X;
+                    item->Data.f2 += Delta.Y;
                 }
             }
         }
@@ -681,6 +978,32 @@ void UTransition::InternalPlay()
 
     TotalTasks = 0;
 
+    if (FUIConfig::Config.BakedTransitions && !bReversed && StartTime == 0 && EndTime == -1)
+    {
+        if (!bTimelineBuilt)
+        {
+            //unchanged instances share the timeline baked for the definition
+            if (!bItemsModified)
+            {
+                if (!Def->bTimelineBuilt)
+                {
+                    Def->Timeline = BakeTimeline(Items);
+                    Def->bTimelineBuilt = true;
+                }
+                Timeline = Def->Timeline;
+            }
+            else
+                Timeline = BakeTimeline(Items);
+            bTimelineBuilt = true;
+        }
+
+        if (Timeline.IsValid())
+        {
+            PlayTimeline();
+            return;
+        }
+    }
+
     bool bNeedSkipAnimations = false;
     int32 cnt = Items.Num();
     if (!bReversed)
@@ -691,10 +1014,10 @@ void UTransition::InternalPlay()
             if (item->Target == nullptr)
                 continue;
 
-            if (item->Type == ETransitionActionType::Animation && StartTime != 0 && item->Time <= StartTime)
+            if (item->Def->Type == ETransitionActionType::Animation && StartTime != 0 && item->Def->Time <= StartTime)
             {
                 bNeedSkipAnimations = true;
-                item->AniData->bFlag = false;
+                item->bAniFlag = false;
             }
             else
                 PlayItem(item);
@@ -716,15 +1039,106 @@ void UTransition::InternalPlay()
         SkipAnimations();
 }
 
+void UTransition::PlayTimeline()
+{
+    TimelinePlayCount++;
+    PlayingTimeline = Timeline;
+    TrackKeys.Init(-1, Timeline->Tracks.Num());
+    SettledKeys.Init(-1, Timeline->Tracks.Num());
+    NextEvent = 0;
+
+    if (Timeline->Duration > 0)
+    {
+        TotalTasks++;
+        TimelineHandle = GetTweenManager(Owner).CreateTween()->To(0.f, Timeline->Duration, Timeline->Duration)
+            ->SetEase(EEaseType::Linear)
+            ->SetTimeScale(TimeScale)
+            ->OnUpdate(FTweenDelegate::CreateUObject(this, &UTransition::OnTimelineUpdate))
+            ->OnComplete(FTweenDelegate::CreateUObject(this, &UTransition::OnTimelineComplete))
+            ->GetHandle();
+    }
+
+    UpdateTimeline(0);
+}
+
+void UTransition::UpdateTimeline(float Time)
+{
+    //keep the timeline alive and stop if a hook stops or replays the transition
+    TSharedPtr<FTransitionTimeline> timeline = PlayingTimeline;
+    int32 playCount = TimelinePlayCount;
+
+    int32 cnt = timeline->Tracks.Num();
+    for (int32 i = 0; i < cnt; i++)
+    {
+        const FTimelineTrack& track = timeline->Tracks[i];
+        int32& keyIndex = TrackKeys[i];
+        while (keyIndex + 1 < track.Keys.Num() && track.Keys[keyIndex + 1].Time <= Time)
+            keyIndex++;
+        if (keyIndex < 0)
+            continue;
+
+        const FTimelineKey& key = track.Keys[keyIndex];
+        UGObject* target = Items[key.ItemIndex]->Target;
+        if (target == nullptr)
+            continue;
+
+        float tt = Time - key.Time;
+        if (tt >= key.Duration)
+        {
+            if (SettledKeys[i] == keyIndex)
+                continue;
+
+            SettledKeys[i] = keyIndex;
+            ApplyTrackValue(track.Type, target, Owner, OwnerBasePos, key.EndValue);
+        }
+        else
+        {
+            float ratio = EaseManager::Evaluate(key.EaseType, tt, key.Duration, 1.70158f, 0);
+            ApplyTrackValue(track.Type, target, Owner, OwnerBasePos, key.StartValue + (key.EndValue - key.StartValue) * ratio);
+        }
+    }
+
+    cnt = timeline->Events.Num();
+    while (NextEvent < cnt && timeline->Events[NextEvent].Time <= Time)
+    {
+        const FTimelineEvent& evt = timeline->Events[NextEvent++];
+        FTransitionItem* item = Items[evt.ItemIndex];
+        if (item->Target == nullptr)
+            continue;
+
+        if (!item->Def->TweenConfig.IsSet())
+            ApplyValue(item);
+        CallHook(item, evt.bTweenEnd);
+
+        if (playCount != TimelinePlayCount || PlayingTimeline != timeline)
+            break;
+    }
+}
+
+void UTransition::OnTimelineUpdate(FGTweener* Tweener)
+{
+    if (PlayingTimeline.IsValid())
+        UpdateTimeline(Tweener->Value.X);
+}
+
+void UTransition::OnTimelineComplete(FGTweener* Tweener)
+{
+    TimelineHandle.Invalidate();
+    PlayingTimeline.Reset();
+    TotalTasks--;
+
+    CheckAllComplete();
+}
+
 void UTransition::PlayItem(FTransitionItem* item)
 {
     float time;
-    if (item->TweenConfig.IsSet())
+    if (item->Def->TweenConfig.IsSet())
     {
         if (bReversed)
-            time = (TotalDuration - item->Time - item->TweenConfig->Duration);
+            time = (TotalDuration - item->Def->Time - item->Def->TweenConfig->Duration);
         else
-            time = item->Time;
+            time = item->Def->Time;
 
         if (EndTime == -1 || time <= EndTime)
         {
@@ -733,46 +1147,46 @@ void UTransition::PlayItem(FTransitionItem* item)
 
             if (bReversed)
             {
-                startValue = &item->TweenConfig->EndData;
-                endValue = &item->TweenConfig->StartData;
+                startValue = &item->Def->TweenConfig->EndData;
+                endValue = &item->Def->TweenConfig->StartData;
             }
             else
             {
-                startValue = &item->TweenConfig->StartData;
-                endValue = &item->TweenConfig->EndData;
+                startValue = &item->Def->TweenConfig->StartData;
+                endValue = &item->Def->TweenConfig->EndData;
             }
 
-            item->Data->b1 = startValue->b1 || endValue->b1;
-            item->Data->b2 = startValue->b2 || endValue->b2;
+            item->Data.b1 = startValue->b1 || endValue->b1;
+            item->Data.b2 = startValue->b2 || endValue->b2;
 
-            switch (item->Type)
+            switch (item->Def->Type)
             {
             case ETransitionActionType::XY:
             case ETransitionActionType::Size:
             case ETransitionActionType::Scale:
             case ETransitionActionType::Skew:
-                item->Tweener = FGTween::To(startValue->GetVec2(), endValue->GetVec2(), item->TweenConfig->Duration);
+                item->Tweener = GetTweenManager(Owner).CreateTween()->To(startValue->GetVec2(), endValue->GetVec2(), item->Def->TweenConfig->Duration);
                 break;
 
             case ETransitionActionType::Alpha:
             case ETransitionActionType::Rotation:
-                item->Tweener = FGTween::To(startValue->f1, endValue->f1, item->TweenConfig->Duration);
+                item->Tweener = GetTweenManager(Owner).CreateTween()->To(startValue->f1, endValue->f1, item->Def->TweenConfig->Duration);
                 break;
 
             case ETransitionActionType::Color:
-                item->Tweener = FGTween::To(startValue->GetColor(), endValue->GetColor(), item->TweenConfig->Duration);
+                item->Tweener = GetTweenManager(Owner).CreateTween()->To(startValue->GetColor(), endValue->GetColor(), item->Def->TweenConfig->Duration);
                 break;
 
             case ETransitionActionType::ColorFilter:
-                item->Tweener = FGTween::To(startValue->GetVec4(), endValue->GetVec4(), item->TweenConfig->Duration);
+                item->Tweener = GetTweenManager(Owner).CreateTween()->To(startValue->GetVec4(), endValue->GetVec4(), item->Def->TweenConfig->Duration);
                 break;
             default:
                 break;
             }
 
             item->Tweener->SetDelay(time)
-                ->SetEase(item->TweenConfig->EaseType)
-                ->SetRepeat(item->TweenConfig->Repeat, item->TweenConfig->bYoyo)
+                ->SetEase(item->Def->TweenConfig->EaseType)
+                ->SetRepeat(item->Def->TweenConfig->Repeat, item->Def->TweenConfig->bYoyo)
                 ->SetTimeScale(TimeScale)
                 ->SetUserData(FNVariant(item))
                 ->OnStart(FTweenDelegate::CreateUObject(this, &UTransition::OnTweenStart))
@@ -785,18 +1199,18 @@ void UTransition::PlayItem(FTransitionItem* item)
             TotalTasks++;
         }
     }
-    else if (item->Type == ETransitionActionType::Shake)
+    else if (item->Def->Type == ETransitionActionType::Shake)
     {
         if (bReversed)
-            time = (TotalDuration - item->Time - item->ShakeData->Duration);
+            time = (TotalDuration - item->Def->Time - item->Def->ShakeData->Duration);
         else
-            time = item->Time;
+            time = item->Def->Time;
 
         if (EndTime == -1 || time <= EndTime)
         {
-            item->ShakeData->LastOffset.Set(0, 0);
-            item->ShakeData->Offset.Set(0, 0);
-            item->Tweener = FGTween::Shake(FVector2D::ZeroVector, item->ShakeData->Amplitude, item->ShakeData->Duration)
+            item->ShakeLastOffset.Set(0, 0);
+            item->ShakeOffset.Set(0, 0);
+            item->Tweener = GetTweenManager(Owner).CreateTween()->Shake(FVector2D::ZeroVector, item->Def->ShakeData->Amplitude, item->Def->ShakeData->Duration)
                 ->SetDelay(time)
                 ->SetTimeScale(TimeScale)
                 ->SetUserData(FNVariant(item))
@@ -805,7 +1219,7 @@ void UTransition::PlayItem(FTransitionItem* item)
                 ->OnComplete(FTweenDelegate::CreateUObject(this, &UTransition::OnTweenComplete));
 
             if (EndTime >= 0)
-                item->Tweener->SetBreakpoint(EndTime - item->Time);
+                item->Tweener->SetBreakpoint(EndTime - item->Def->Time);
 
             TotalTasks++;
         }
@@ -813,9 +1227,9 @@ void UTransition::PlayItem(FTransitionItem* item)
     else
     {
         if (bReversed)
-            time = (TotalDuration - item->Time);
+            time = (TotalDuration - item->Def->Time);
         else
-            time = item->Time;
+            time = item->Def->Time;
 
         if (time <= StartTime)
         {
@@ -825,7 +1239,7 @@ void UTransition::PlayItem(FTransitionItem* item)
         else if (EndTime == -1 || time <= EndTime)
         {
             TotalTasks++;
-            item->Tweener = FGTween::DelayedCall(time)
+            item->Tweener = GetTweenManager(Owner).CreateTween()->SetDelay(time)
                 ->SetTimeScale(TimeScale)
                 ->SetUserData(FNVariant(item))
                 ->OnComplete(FTweenDelegate::CreateUObject(this, &UTransition::OnDelayedPlayItem));
@@ -847,10 +1261,10 @@ void UTransition::SkipAnimations()
     for (int32 i = 0; i < cnt; i++)
     {
         FTransitionItem* item = Items[i];
-        if (item->Type != ETransitionActionType::Animation || item->Time > StartTime)
+        if (item->Def->Type != ETransitionActionType::Animation || item->Def->Time > StartTime)
             continue;
 
-        if (item->AniData->bFlag)
+        if (item->bAniFlag)
             continue;
 
         target = item->Target;
@@ -861,31 +1275,31 @@ void UTransition::SkipAnimations()
         for (int32 j = i; j < cnt; j++)
         {
             item = Items[j];
-            if (item->Type != ETransitionActionType::Animation || item->Target != target || item->Time > StartTime)
+            if (item->Def->Type != ETransitionActionType::Animation || item->Target != target || item->Def->Time > StartTime)
                 continue;
 
-            item->AniData->bFlag = true;
+            item->bAniFlag = true;
 
-            if (item->AniData->Frame != -1)
+            if (item->Def->AniData->Frame != -1)
             {
-                frame = item->AniData->Frame;
-                if (item->AniData->bPlaying)
-                    playStartTime = item->Time;
+                frame = item->Def->AniData->Frame;
+                if (item->Def->AniData->bPlaying)
+                    playStartTime = item->Def->Time;
                 else
                     playStartTime = -1;
                 playTotalTime = 0;
             }
             else
             {
-                if (item->AniData->bPlaying)
+                if (item->Def->AniData->bPlaying)
                 {
                     if (playStartTime < 0)
-                        playStartTime = item->Time;
+                        playStartTime = item->Def->Time;
                 }
                 else
                 {
                     if (playStartTime >= 0)
-                        playTotalTime += (item->Time - playStartTime);
+                        playTotalTime += (item->Def->Time - playStartTime);
                     playStartTime = -1;
                 }
             }
@@ -919,23 +1333,23 @@ void UTransition::OnTweenStart(FGTweener* Tweener)
 {
     FTransitionItem* item = (FTransitionItem*)Tweener->GetUserData().As<void*>();
 
-    if (item->Type == ETransitionActionType::XY || item->Type == ETransitionActionType::Size)
+    if (item->Def->Type == ETransitionActionType::XY || item->Def->Type == ETransitionActionType::Size)
     {
         FTransitionItemData* startValue;
         FTransitionItemData* endValue;
 
         if (bReversed)
         {
-            startValue = &item->TweenConfig->EndData;
-            endValue = &item->TweenConfig->StartData;
+            startValue = &item->Def->TweenConfig->EndData;
+            endValue = &item->Def->TweenConfig->StartData;
         }
         else
         {
-            startValue = &item->TweenConfig->StartData;
-            endValue = &item->TweenConfig->EndData;
+            startValue = &item->Def->TweenConfig->StartData;
+            endValue = &item->Def->TweenConfig->EndData;
         }
 
-        if (item->Type == ETransitionActionType::XY)
+        if (item->Def->Type == ETransitionActionType::XY)
         {
             if (item->Target != Owner)
             {
@@ -985,10 +1399,10 @@ void UTransition::OnTweenStart(FGTweener* Tweener)
                 Tweener->EndValue.Y = Tweener->StartValue.Y;
         }
 
-        if (item->TweenConfig->Path.IsValid())
+        if (item->Def->TweenConfig->Path.IsValid())
         {
-            item->Data->b1 = item->Data->b2 = true;
-            Tweener->SetPath(item->TweenConfig->Path);
+            item->Data.b1 = item->Data.b2 = true;
+            Tweener->SetPath(item->Def->TweenConfig->Path);
         }
     }
 
@@ -999,33 +1413,33 @@ void UTransition::OnTweenUpdate(FGTweener* Tweener)
 {
     FTransitionItem* item = (FTransitionItem*)Tweener->GetUserData().As<void*>();
 
-    switch (item->Type)
+    switch (item->Def->Type)
     {
     case ETransitionActionType::XY:
     case ETransitionActionType::Size:
     case ETransitionActionType::Scale:
     case ETransitionActionType::Skew:
-        if (item->TweenConfig->Path.IsValid())
-            item->Data->SetVec2(Tweener->Value.GetVec2() + Tweener->StartValue.GetVec2());
+        if (item->Def->TweenConfig->Path.IsValid())
+            item->Data.SetVec2(Tweener->Value.GetVec2() + Tweener->StartValue.GetVec2());
         else
-            item->Data->SetVec2(Tweener->Value.GetVec2());
+            item->Data.SetVec2(Tweener->Value.GetVec2());
         break;
 
     case ETransitionActionType::Alpha:
     case ETransitionActionType::Rotation:
-        item->Data->f1 = Tweener->Value.X;
+        item->Data.f1 = Tweener->Value.X;
         break;
 
     case ETransitionActionType::Color:
-        item->Data->SetColor(Tweener->Value.GetColor());
+        item->Data.SetColor(Tweener->Value.GetColor());
         break;
 
     case ETransitionActionType::ColorFilter:
-        item->Data->SetVec4(Tweener->Value.GetVec4());
+        item->Data.SetVec4(Tweener->Value.GetVec4());
         break;
 
     case ETransitionActionType::Shake:
-        item->ShakeData->Offset = Tweener->DeltaValue.GetVec2();
+        item->ShakeOffset = Tweener->DeltaValue.GetVec2();
         break;
     default:
         break;
@@ -1056,12 +1470,12 @@ void UTransition::CallHook(FTransitionItem* item, bool bTweenEnd)
 {
     if (bTweenEnd)
     {
-        if (item->TweenConfig.IsSet() && item->TweenConfig->EndHook.IsBound())
-            item->TweenConfig->EndHook.Execute();
+        if (item->Def->TweenConfig.IsSet() && item->EndHook.IsBound())
+            item->EndHook.Execute();
     }
     else
     {
-        if (item->Time >= StartTime && item->Hook.IsBound())
+        if (item->Def->Time >= StartTime && item->Hook.IsBound())
             item->Hook.Execute();
     }
 }
@@ -1107,38 +1521,38 @@ void UTransition::ApplyValue(FTransitionItem* item)
 {
     item->Target->bGearLocked = true;
 
-    switch (item->Type)
+    switch (item->Def->Type)
     {
     case ETransitionActionType::XY:
     {
         if (item->Target == Owner)
         {
-            if (item->Data->b1 && item->Data->b2)
-                item->Target->SetPosition(item->Data->GetVec2() + OwnerBasePos);
-            else if (item->Data->b1)
-                item->Target->SetX(item->Data->f1 + OwnerBasePos.X);
+            if (item->Data.b1 && item->Data.b2)
+                item->Target->StagePosition(item->Data.GetVec2() + OwnerBasePos);
+            else if (item->Data.b1)
+                item->Target->StageX(item->Data.f1 + OwnerBasePos.X);
             else
-                item->Target->SetY(item->Data->f2 + OwnerBasePos.Y);
+                item->Target->StageY(item->Data.f2 + OwnerBasePos.Y);
         }
         else
         {
-            if (item->Data->b3) //position in percent
+            if (item->Data.b3) //position in percent
             {
-                if (item->Data->b1 && item->Data->b2)
-                    item->Target->SetPosition(item->Data->GetVec2() * Owner->GetSize());
-                else if (item->Data->b1)
-                    item->Target->SetX(item->Data->f1 * Owner->GetWidth());
-                else if (item->Data->b2)
-                    item->Target->SetY(item->Data->f2 * Owner->GetHeight());
+                if (item->Data.b1 && item->Data.b2)
+                    item->Target->StagePosition(item->Data.GetVec2() * Owner->GetSize());
+                else if (item->Data.b1)
+                    item->Target->StageX(item->Data.f1 * Owner->GetWidth());
+                else if (item->Data.b2)
+                    item->Target->StageY(item->Data.f2 * Owner->GetHeight());
             }
             else
             {
-                if (item->Data->b1 && item->Data->b2)
-                    item->Target->SetPosition(item->Data->GetVec2());
-                else if (item->Data->b1)
-                    item->Target->SetX(item->Data->f1);
-                else if (item->Data->b2)
-                    item->Target->SetY(item->Data->f2);
+                if (item->Data.b1 && item->Data.b2)
+                    item->Target->StagePosition(item->Data.GetVec2());
+                else if (item->Data.b1)
+                    item->Target->StageX(item->Data.f1);
+                else if (item->Data.b2)
+                    item->Target->StageY(item->Data.f2);
             }
         }
     }
@@ -1146,81 +1560,81 @@ void UTransition::ApplyValue(FTransitionItem* item)
 
     case ETransitionActionType::Size:
     {
-        if (!item->Data->b1)
-            item->Data->f1 = item->Target->GetWidth();
-        if (!item->Data->b2)
-            item->Data->f2 = item->Target->GetHeight();
-        item->Target->SetSize(item->Data->GetVec2());
+        if (!item->Data.b1)
+            item->Data.f1 = item->Target->GetWidth();
+        if (!item->Data.b2)
+            item->Data.f2 = item->Target->GetHeight();
+        item->Target->StageSize(item->Data.GetVec2());
     }
     break;
 
     case ETransitionActionType::Pivot:
-        item->Target->SetPivot(item->Data->GetVec2(), item->Target->IsPivotAsAnchor());
+        item->Target->SetPivot(item->Data.GetVec2(), item->Target->IsPivotAsAnchor());
         break;
 
     case ETransitionActionType::Alpha:
-        item->Target->SetAlpha(item->Data->f1);
+        item->Target->StageAlpha(item->Data.f1);
         break;
 
     case ETransitionActionType::Rotation:
-        item->Target->SetRotation(item->Data->f1);
+        item->Target->SetRotation(item->Data.f1);
         break;
 
     case ETransitionActionType::Scale:
-        item->Target->SetScale(item->Data->GetVec2());
+        item->Target->SetScale(item->Data.GetVec2());
         break;
 
     case ETransitionActionType::Skew:
-        item->Target->SetSkew(item->Data->GetVec2());
+        item->Target->SetSkew(item->Data.GetVec2());
         break;
 
     case ETransitionActionType::Color:
-        item->Target->SetProp(EObjectPropID::Color, FNVariant(item->Data->GetColor()));
+        item->Target->SetProp(EObjectPropID::Color, FNVariant(item->Data.GetColor()));
         break;
 
     case ETransitionActionType::Animation:
     {
-        if (item->AniData->Frame >= 0)
-            item->Target->SetProp(EObjectPropID::Frame, FNVariant(item->AniData->Frame));
-        item->Target->SetProp(EObjectPropID::Playing, FNVariant(item->AniData->bPlaying));
+        if (item->Def->AniData->Frame >= 0)
+            item->Target->SetProp(EObjectPropID::Frame, FNVariant(item->Def->AniData->Frame));
+        item->Target->SetProp(EObjectPropID::Playing, FNVariant(item->Def->AniData->bPlaying));
         item->Target->SetProp(EObjectPropID::TimeScale, FNVariant(TimeScale));
         break;
     }
 
     case ETransitionActionType::Visible:
-        item->Target->SetVisible(item->VisibleData.GetValue());
+        item->Target->SetVisible(item->Def->VisibleData.GetValue());
         break;
 
     case ETransitionActionType::Shake:
     {
-        item->Target->SetPosition(item->Target->GetPosition() - item->ShakeData->LastOffset + item->ShakeData->Offset);
-        item->ShakeData->LastOffset = item->ShakeData->Offset;
+        item->Target->SetPosition(item->Target->GetPosition() - item->ShakeLastOffset + item->ShakeOffset);
+        item->ShakeLastOffset = item->ShakeOffset;
         break;
     }
 
     case ETransitionActionType::Transition:
         if (bPlaying)
         {
-            if (item->TransData->Instance != nullptr)
+            if (item->TransInstance != nullptr)
             {
                 TotalTasks++;
 
-                float playStartTime = StartTime > item->Time ? (StartTime - item->Time) : 0;
-                float playEndTime = EndTime >= 0 ? (EndTime - item->Time) : -1;
-                if (item->TransData->StopTime >= 0 && (playEndTime < 0 || playEndTime > item->TransData->StopTime))
-                    playEndTime = item->TransData->StopTime;
-                item->TransData->Instance->SetTimeScale(TimeScale);
-                item->TransData->Instance->Play(item->TransData->PlayTimes, 0, playStartTime, playEndTime, bReversed,
+                float playStartTime = StartTime > item->Def->Time ? (StartTime - item->Def->Time) : 0;
+                float playEndTime = EndTime >= 0 ? (EndTime - item->Def->Time) : -1;
+                if (item->TransStopTime >= 0 && (playEndTime < 0 || playEndTime > item->TransStopTime))
+                    playEndTime = item->TransStopTime;
+                item->TransInstance->SetTimeScale(TimeScale);
+                item->TransInstance->Play(item->Def->TransData->PlayTimes, 0, playStartTime, playEndTime, bReversed,
                     FSimpleDelegate::CreateUObject(this, &UTransition::OnPlayTransCompleted, item));
             }
         }
         break;
 
     case ETransitionActionType::Sound:
-        if (bPlaying && item->Time >= StartTime)
+        if (bPlaying && item->Def->Time >= StartTime)
         {
-            if (!item->SoundData->URL.IsEmpty())
-                Owner->GetApp()->PlaySound(item->SoundData->URL, item->SoundData->Volume);
+            if (!item->Def->SoundData->URL.IsEmpty())
+                Owner->GetApp()->PlaySound(item->Def->SoundData->URL, item->Def->SoundData->Volume);
             break;
         }
 
@@ -1228,11 +1642,11 @@ void UTransition::ApplyValue(FTransitionItem* item)
         break;
 
     case ETransitionActionType::Text:
-        item->Target->SetText(item->TextData.GetValue());
+        item->Target->SetText(item->Def->TextData.GetValue());
         break;
 
     case ETransitionActionType::Icon:
-        item->Target->SetIcon(item->TextData.GetValue());
+        item->Target->SetIcon(item->Def->TextData.GetValue());
         break;
     default:
         break;
@@ -1242,14 +1656,45 @@ void UTransition::ApplyValue(FTransitionItem* item)
 }
 
 void UTransition::Setup(FByteBuffer* Buffer)
+{
+    Setup(CreateDefinition(Buffer, Cast<UGComponent>(GetOuter())));
+}
+
+void UTransition::Setup(const TSharedPtr<FTransitionDef>& InDef)
 {
     Owner = Cast<UGComponent>(GetOuter());
+    Def = InDef;
+
+    Name = Def->Name;
+    Options = Def->Options;
+    bAutoPlay = Def->bAutoPlay;
+    AutoPlayTimes = Def->AutoPlayTimes;
+    AutoPlayDelay = Def->AutoPlayDelay;
+    TotalDuration = Def->TotalDuration;
+
+    //one block for the playback state of all items
+    int32 cnt = Def->Items.Num();
+    if (cnt > 0)
+    {
+        ItemStates = new FTransitionItem[cnt];
+        Items.Reserve(cnt);
+        for (int32 i = 0; i < cnt; i++)
+        {
+            ItemStates[i].Init(&Def->Items[i]);
+            Items.Add(&ItemStates[i]);
+        }
+    }
+}
 
-    Name = Buffer->ReadS();
-    Options = Buffer->ReadInt();
-    bAutoPlay = Buffer->ReadBool();
-    AutoPlayTimes = Buffer->ReadInt();
-    AutoPlayDelay = Buffer->ReadFloat();
+TSharedPtr<FTransitionDef> UTransition::CreateDefinition(FByteBuffer* Buffer, UGComponent* InOwner)
+{
+    TSharedPtr<FTransitionDef> def = MakeShareable(new FTransitionDef());
+
+    def->Name = Buffer->ReadS();
+    def->Options = Buffer->ReadInt();
+    def->bAutoPlay = Buffer->ReadBool();
+    def->AutoPlayTimes = Buffer->ReadInt();
+    def->AutoPlayDelay = Buffer->ReadFloat();
 
     int32 cnt = Buffer->ReadShort();
     for (int32 i = 0; i < cnt; i++)
@@ -1259,15 +1704,15 @@ void UTransition::Setup(FByteBuffer* Buffer)
 
         Buffer->Seek(curPos, 0);
 
-        Items.Add(new FTransitionItem((ETransitionActionType)Buffer->ReadByte()));
-        FTransitionItem* item = Items.Last();
+        def->Items.Emplace((ETransitionActionType)Buffer->ReadByte());
+        FTransitionItemDef* item = &def->Items.Last();
 
         item->Time = Buffer->ReadFloat();
         int32 TargetID = Buffer->ReadShort();
         if (TargetID < 0)
             item->TargetID = G_EMPTY_STRING;
         else
-            item->TargetID = Owner->GetChildAt(TargetID)->ID;
+            item->TargetID = InOwner->GetChildAt(TargetID)->ID;
         item->Label = Buffer->ReadS();
 
         if (Buffer->ReadBool())
@@ -1276,8 +1721,8 @@ void UTransition::Setup(FByteBuffer* Buffer)
 
             item->TweenConfig.Emplace();
             item->TweenConfig->Duration = Buffer->ReadFloat();
-            if (item->Time + item->TweenConfig->Duration > TotalDuration)
-                TotalDuration = item->Time + item->TweenConfig->Duration;
+            if (item->Time + item->TweenConfig->Duration > def->TotalDuration)
+                def->TotalDuration = item->Time + item->TweenConfig->Duration;
             item->TweenConfig->EaseType = (EEaseType)Buffer->ReadByte();
             item->TweenConfig->Repeat = Buffer->ReadInt();
             item->TweenConfig->bYoyo = Buffer->ReadBool();
@@ -1338,8 +1783,8 @@ void UTransition::Setup(FByteBuffer* Buffer)
         }
         else
         {
-            if (item->Time > TotalDuration)
-                TotalDuration = item->Time;
+            if (item->Time > def->TotalDuration)
+                def->TotalDuration = item->Time;
 
             Buffer->Seek(curPos, 2);
 
@@ -1348,9 +1793,11 @@ void UTransition::Setup(FByteBuffer* Buffer)
 
         Buffer->SetPos(curPos + dataLen);
     }
+
+    return def;
 }
 
-void UTransition::DecodeValue(FTransitionItem* item, FByteBuffer* Buffer, FTransitionItemData* Value)
+void UTransition::DecodeValue(FTransitionItemDef* item, FByteBuffer* Buffer, FTransitionItemData* Value)
 {
     switch (item->Type)
     {
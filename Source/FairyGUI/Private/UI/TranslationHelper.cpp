@@ -1,13 +1,289 @@
 #include "UI/TranslationHelper.h"
+#include "UI/UIPackage.h"
+#include "UI/PackageItem.h"
+#include "Utils/ByteBuffer.h"
+#include "Utils/XMLIterator.h"
 
 TMap<FString, TMap<FString, FString>> FTranslationHelper::Strings;
 
+static void WriteOrSkip(FByteBuffer* Buffer, const FString* Value)
+{
+    if (Value != nullptr)
+        Buffer->WriteS(*Value);
+    else
+        Buffer->Skip(2);
+}
+
 void FTranslationHelper::LoadFromXML(const FString XmlString)
 {
+    Strings.Reset();
+
+    FString Key;
+    FString Text;
+    bool bInString = false;
+
+    FXMLIterator XMLIterator;
+    XMLIterator.Begin(XmlString);
+    while (XMLIterator.NextTag())
+    {
+        if (bInString)
+            Text += XMLIterator.GetText();
+
+        if (XMLIterator.TagType == EXMLTagType::CDATA)
+        {
+            if (bInString)
+            {
+                FString Source = XMLIterator.GetTagSource();
+                Text += Source.Mid(9, Source.Len() - 12);
+            }
+        }
+        else if (XMLIterator.TagName == TEXT("string"))
+        {
+            if (XMLIterator.TagType == EXMLTagType::Start)
+            {
+                XMLIterator.ParseAttributes();
+                Key = XMLIterator.Attributes.Get("name");
+                Text.Reset();
+                bInString = true;
+            }
+            else if (XMLIterator.TagType == EXMLTagType::End && bInString)
+            {
+                bInString = false;
 
+                //name is "<package id><component id>-<element id>[-<suffix>]"
+                int32 i;
+                if (Key.FindChar('-', i))
+                    Strings.FindOrAdd(Key.Left(i)).Add(Key.Mid(i + 1), Text);
+            }
+        }
+    }
+
+    //Put the source strings back so that components constructed from now on pick up the new language.
+    //Atlases and other loaded assets are left untouched.
+    for (UUIPackage* Pkg : UUIPackageStatic::Get().PackageList)
+    {
+        for (auto& Item : Pkg->Items)
+        {
+            if (!Item->bTranslated)
+                continue;
+
+            Item->bTranslated = false;
+            if (Pkg->SourceStrings.Num() > 0 && Item->RawData.IsValid())
+            {
+                *Item->RawData->StringTable = Pkg->SourceStrings;
+                Pkg->SourceStrings.Reset();
+            }
+        }
+    }
 }
 
 void FTranslationHelper::TranslateComponent(const TSharedPtr<FPackageItem>& Item)
 {
+    if (Strings.Num() == 0)
+        return;
+
+    const TMap<FString, FString>* Col = Strings.Find(Item->Owner->GetID() + Item->ID);
+    if (Col == nullptr)
+        return;
+
+    FByteBuffer* Buffer = Item->RawData.Get();
+
+    //The string table is shared by every component of the package, keep a copy of the source
+    //strings the first time it is modified so that another language can be applied later.
+    UUIPackage* Pkg = Item->Owner;
+    if (Pkg->SourceStrings.Num() == 0)
+        Pkg->SourceStrings = *Buffer->StringTable;
+
+    Buffer->Seek(0, 2);
+
+    int32 childCount = Buffer->ReadShort();
+    for (int32 i = 0; i < childCount; i++)
+    {
+        int32 dataLen = Buffer->ReadShort();
+        int32 curPos = Buffer->GetPos();
+
+        Buffer->Seek(curPos, 0);
+
+        EObjectType baseType = (EObjectType)Buffer->ReadByte();
+        EObjectType type = baseType;
+        Buffer->Skip(4);
+        const FString elementId = Buffer->ReadS();
+
+        if (type == EObjectType::Component)
+        {
+            if (Buffer->Seek(curPos, 6))
+                type = (EObjectType)Buffer->ReadByte();
+        }
+
+        Buffer->Seek(curPos, 1);
+
+        const FString* Value;
+        if ((Value = Col->Find(elementId + "-tips")) != nullptr)
+            Buffer->WriteS(*Value);
+
+        Buffer->Seek(curPos, 2);
+
+        int32 gearCount = Buffer->ReadShort();
+        for (int32 j = 0; j < gearCount; j++)
+        {
+            int32 nextPos = Buffer->ReadShort();
+            nextPos += Buffer->GetPos();
+
+            if (Buffer->ReadByte() == 6) //gearText
+            {
+                Buffer->Skip(2); //controller
+                int32 valueCount = Buffer->ReadShort();
+                for (int32 k = 0; k < valueCount; k++)
+                {
+                    const FString& page = Buffer->ReadS();
+                    if (!page.IsEmpty())
+                        WriteOrSkip(Buffer, Col->Find(elementId + "-texts_" + FString::FromInt(k)));
+                }
+
+                if (Buffer->ReadBool() && (Value = Col->Find(elementId + "-texts_def")) != nullptr)
+                    Buffer->WriteS(*Value);
+            }
+
+            Buffer->SetPos(nextPos);
+        }
 
-}
\ No newline at end of file
+        if (baseType == EObjectType::Component && Buffer->Version >= 2)
+        {
+            Buffer->Seek(curPos, 4);
+
+            Buffer->Skip(2); //pageController
+            Buffer->Skip(4 * Buffer->ReadShort());
+
+            int32 cpCount = Buffer->ReadShort();
+            for (int32 k = 0; k < cpCount; k++)
+            {
+                FString target = Buffer->ReadS();
+                int32 propertyId = Buffer->ReadShort();
+                if (propertyId == 0)
+                    WriteOrSkip(Buffer, Col->Find(elementId + "-cp-" + target));
+                else
+                    Buffer->Skip(2);
+            }
+        }
+
+        switch (type)
+        {
+        case EObjectType::Text:
+        case EObjectType::RichText:
+        case EObjectType::InputText:
+        {
+            if ((Value = Col->Find(elementId)) != nullptr)
+            {
+                Buffer->Seek(curPos, 6);
+                Buffer->WriteS(*Value);
+            }
+            if ((Value = Col->Find(elementId + "-prompt")) != nullptr)
+            {
+                Buffer->Seek(curPos, 4);
+                Buffer->WriteS(*Value);
+            }
+            break;
+        }
+
+        case EObjectType::List:
+        case EObjectType::Tree:
+        {
+            Buffer->Seek(curPos, 8);
+            Buffer->Skip(2);
+            int32 itemCount = Buffer->ReadShort();
+            for (int32 j = 0; j < itemCount; j++)
+            {
+                int32 nextPos = Buffer->ReadShort();
+                nextPos += Buffer->GetPos();
+
+                Buffer->Skip(2); //url
+                if (type == EObjectType::Tree)
+                    Buffer->Skip(2);
+
+                FString itemKey = elementId + "-" + FString::FromInt(j);
+
+                //title
+                WriteOrSkip(Buffer, Col->Find(itemKey));
+
+                //selected title
+                WriteOrSkip(Buffer, Col->Find(itemKey + "-0"));
+
+                if (Buffer->Version >= 2)
+                {
+                    Buffer->Skip(6);
+                    Buffer->Skip(Buffer->ReadShort() * 4); //controllers
+
+                    int32 cpCount = Buffer->ReadShort();
+                    for (int32 k = 0; k < cpCount; k++)
+                    {
+                        FString target = Buffer->ReadS();
+                        int32 propertyId = Buffer->ReadShort();
+                        if (propertyId == 0)
+                            WriteOrSkip(Buffer, Col->Find(itemKey + "-" + target));
+                        else
+                            Buffer->Skip(2);
+                    }
+                }
+
+                Buffer->SetPos(nextPos);
+            }
+            break;
+        }
+
+        case EObjectType::Label:
+        {
+            if (Buffer->Seek(curPos, 6) && (EObjectType)Buffer->ReadByte() == type)
+            {
+                WriteOrSkip(Buffer, Col->Find(elementId));
+
+                Buffer->Skip(2);
+                if (Buffer->ReadBool())
+                    Buffer->Skip(4);
+                Buffer->Skip(4);
+                if (Buffer->ReadBool() && (Value = Col->Find(elementId + "-prompt")) != nullptr)
+                    Buffer->WriteS(*Value);
+            }
+            break;
+        }
+
+        case EObjectType::Button:
+        {
+            if (Buffer->Seek(curPos, 6) && (EObjectType)Buffer->ReadByte() == type)
+            {
+                WriteOrSkip(Buffer, Col->Find(elementId));
+
+                if ((Value = Col->Find(elementId + "-0")) != nullptr)
+                    Buffer->WriteS(*Value);
+            }
+            break;
+        }
+
+        case EObjectType::ComboBox:
+        {
+            if (Buffer->Seek(curPos, 6) && (EObjectType)Buffer->ReadByte() == type)
+            {
+                int32 itemCount = Buffer->ReadShort();
+                for (int32 j = 0; j < itemCount; j++)
+                {
+                    int32 nextPos = Buffer->ReadShort();
+                    nextPos += Buffer->GetPos();
+
+                    if ((Value = Col->Find(elementId + "-" + FString::FromInt(j))) != nullptr)
+                        Buffer->WriteS(*Value);
+
+                    Buffer->SetPos(nextPos);
+                }
+
+                if ((Value = Col->Find(elementId)) != nullptr)
+                    Buffer->WriteS(*Value);
+            }
+            break;
+        }
+
+        default:
+            break;
+        }
+
+        Buffer->SetPos(curPos + dataLen);
+    }
+}
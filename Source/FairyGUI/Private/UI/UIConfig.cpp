@@ -9,6 +9,10 @@ FUIConfig::FUIConfig() :
     DefaultScrollDecelerationRate(0.967f),
     DefaultScrollTouchEffect(true),
     DefaultScrollBounceEffect(true),
+    FrameSyncedScrolling(false),
+    EaseTableResolution(0),
+    BakedTransitions(false),
+    CoalescePropertyWrites(false),
     DefaultScrollBarDisplay(EScrollBarDisplayType::Default),
     TouchDragSensitivity(10),
     ClickDragSensitivity(2),
@@ -53,7 +53,10 @@ UGObject* FUIObjectFactory::NewObject(const TSharedPtr<FPackageItem>& PackageIte
     else
         obj = NewObject(PackageItem->ObjectType, Outer);
     if (obj != nullptr)
+    {
         obj->PackageItem = PackageItem;
+        obj->ResourceHandle = PackageItem->Handle;
+    }
 
     return obj;
 }
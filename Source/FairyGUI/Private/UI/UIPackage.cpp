@@ -6,6 +6,7 @@
 #include "Widgets/NTexture.h"
 #include "Widgets/SMovieClip.h"
 #include "Widgets/BitmapFont.h"
+#include "Widgets/NTextFormat.h"
 #include "Utils/ByteBuffer.h"
 #include "UI/UIObjectFactory.h"
 
@@ -294,6 +295,7 @@ UGObject* UUIPackage::CreateObject(const TSharedPtr<FPackageItem>& Item, UObject
 void UUIPackage::RegisterFont(const FString& FontFace, UObject* Font)
 {
     UUIPackageStatic::Get().Fonts.Add(FontFace, Font);
+    FNTextFormat::ClearStyleCache();
 }
 
 void UUIPackage::Load(FByteBuffer* Buffer)
@@ -765,4 +767,5 @@ void UUIPackageStatic::Destroy()
         Singleton->RemoveFromRoot();
         Singleton = nullptr;
     }
+    FNTextFormat::ClearStyleCache();
 }
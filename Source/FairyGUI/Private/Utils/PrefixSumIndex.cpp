@@ -0,0 +1,124 @@
+#include "Utils/PrefixSumIndex.h"
+
+//Tree is 1-based, node i covers the (i & -i) entries ending at entry i - 1.
+
+FPrefixSumIndex::FPrefixSumIndex() :
+    Total(0)
+{
+}
+
+void FPrefixSumIndex::Reset()
+{
+    Values.Reset();
+    Tree.Reset();
+    Tree.Add(0);
+    Total = 0;
+}
+
+void FPrefixSumIndex::Add(float Value)
+{
+    if (Tree.Num() == 0)
+        Tree.Add(0);
+
+    int32 i = Values.Num() + 1;
+    double Sum = Value;
+    for (int32 j = i - 1, Stop = i - (i & -i); j > Stop; j -= j & -j)
+        Sum += Tree[j];
+
+    Values.Add(Value);
+    Tree.Add(Sum);
+    Total += Value;
+}
+
+void FPrefixSumIndex::Truncate(int32 NewNum)
+{
+    //a node never covers entries after its own, so the leading nodes stay valid
+    if (NewNum >= Values.Num())
+        return;
+
+    for (int32 i = NewNum; i < Values.Num(); i++)
+        Total -= Values[i];
+    Values.SetNum(NewNum, false);
+    Tree.SetNum(NewNum + 1, false);
+    if (NewNum == 0)
+        Total = 0;
+}
+
+void FPrefixSumIndex::Splice(int32 Index, int32 RemoveCount, const TArray<float>& InValues)
+{
+    Index = FMath::Clamp(Index, 0, Values.Num());
+    RemoveCount = FMath::Clamp(RemoveCount, 0, Values.Num() - Index);
+
+    for (int32 i = Index; i < Index + RemoveCount; i++)
+        Total -= Values[i];
+    for (float Value : InValues)
+        Total += Value;
+    Values.RemoveAt(Index, RemoveCount, false);
+    Values.Insert(InValues, Index);
+    if (Values.Num() == 0)
+        Total = 0;
+
+    //the nodes up to Index only cover entries before it, the others are built again as Add does
+    if (Tree.Num() == 0)
+        Tree.Add(0);
+    Tree.SetNum(Index + 1, false);
+    for (int32 i = Index + 1; i <= Values.Num(); i++)
+    {
+        double Sum = Values[i - 1];
+        for (int32 j = i - 1, Stop = i - (i & -i); j > Stop; j -= j & -j)
+            Sum += Tree[j];
+        Tree.Add(Sum);
+    }
+}
+
+void FPrefixSumIndex::Set(int32 Index, float Value)
+{
+    if (Index < 0 || Index >= Values.Num() || Values[Index] == Value)
+        return;
+
+    double Delta = (double)Value - Values[Index];
+    Values[Index] = Value;
+    Total += Delta;
+    for (int32 i = Index + 1; i < Tree.Num(); i += i & -i)
+        Tree[i] += Delta;
+}
+
+float FPrefixSumIndex::GetSum(int32 Count, float Gap) const
+{
+    Count = FMath::Clamp(Count, 0, Values.Num());
+
+    double Sum = 0;
+    for (int32 i = Count; i > 0; i -= i & -i)
+        Sum += Tree[i];
+
+    return (float)Sum + Count * Gap;
+}
+
+int32 FPrefixSumIndex::Find(float Pos, float Gap) const
+{
+    int32 Count = Values.Num();
+    if (Count == 0 || Pos < 0)
+        return 0;
+
+    int32 Step = 1;
+    while (Step * 2 <= Count)
+        Step *= 2;
+
+    int32 i = 0;
+    double Sum = 0;
+    for (; Step > 0; Step /= 2)
+    {
+        int32 j = i + Step;
+        if (j <= Count)
+        {
+            double NodeSum = Tree[j] + (double)Step * Gap;
+            if (Sum + NodeSum <= Pos)
+            {
+                i = j;
+                Sum += NodeSum;
+            }
+        }
+    }
+
+    return i;
+}
@@ -0,0 +1,195 @@
+#include "Utils/SpatialGrid.h"
+
+//an object covering more cells than this is not worth linking into each of them
+static const int32 MaxLinkedCells = 64;
+
+FSpatialGrid::FSpatialGrid(float InCellSize) :
+    CellSize(FMath::Max(InCellSize, 1.0f)),
+    Bounds(ForceInit),
+    bBoundsDirty(false)
+{
+}
+
+FIntPoint FSpatialGrid::ToCell(const FVector2D& Pos) const
+{
+    return FIntPoint(FMath::FloorToInt(Pos.X / CellSize), FMath::FloorToInt(Pos.Y / CellSize));
+}
+
+void FSpatialGrid::Update(UGObject* Obj, const FBox2D& Rect)
+{
+    FEntry NewEntry;
+    NewEntry.Rect = Rect;
+    NewEntry.MinCell = ToCell(Rect.Min);
+    NewEntry.MaxCell = ToCell(Rect.Max);
+    NewEntry.bOversized = (int64)(NewEntry.MaxCell.X - NewEntry.MinCell.X + 1) * (NewEntry.MaxCell.Y - NewEntry.MinCell.Y + 1) > MaxLinkedCells;
+    NewEntry.IndexHint = INDEX_NONE;
+
+    FEntry* Entry = Entries.Find(Obj);
+    if (Entry != nullptr && IsOnBoundsEdge(Entry->Rect))
+        bBoundsDirty = true;
+    if (!bBoundsDirty)
+        Bounds += Rect;
+
+    if (Entry != nullptr)
+    {
+        NewEntry.IndexHint = Entry->IndexHint;
+        if (Entry->MinCell == NewEntry.MinCell && Entry->MaxCell == NewEntry.MaxCell)
+        {
+            Entry->Rect = Rect;
+            return;
+        }
+
+        Unlink(Obj, *Entry);
+        *Entry = NewEntry;
+    }
+    else
+        Entries.Add(Obj, NewEntry);
+
+    Link(Obj, NewEntry);
+}
+
+void FSpatialGrid::Remove(UGObject* Obj)
+{
+    FEntry Entry;
+    if (Entries.RemoveAndCopyValue(Obj, Entry))
+    {
+        Unlink(Obj, Entry);
+        if (IsOnBoundsEdge(Entry.Rect))
+            bBoundsDirty = true;
+    }
+}
+
+void FSpatialGrid::Reset()
+{
+    Entries.Reset();
+    Cells.Reset();
+    Oversized.Reset();
+    Bounds.Init();
+    bBoundsDirty = false;
+}
+
+bool FSpatialGrid::IsOnBoundsEdge(const FBox2D& Rect) const
+{
+    return Rect.Min.X <= Bounds.Min.X || Rect.Min.Y <= Bounds.Min.Y || Rect.Max.X >= Bounds.Max.X || Rect.Max.Y >= Bounds.Max.Y;
+}
+
+int32 FSpatialGrid::GetIndexHint(UGObject* Obj) const
+{
+    const FEntry* Entry = Entries.Find(Obj);
+    return Entry != nullptr ? Entry->IndexHint : INDEX_NONE;
+}
+
+void FSpatialGrid::SetIndexHint(UGObject* Obj, int32 Index)
+{
+    FEntry* Entry = Entries.Find(Obj);
+    if (Entry != nullptr)
+        Entry->IndexHint = Index;
+}
+
+void FSpatialGrid::Link(UGObject* Obj, const FEntry& Entry)
+{
+    if (Entry.bOversized)
+    {
+        Oversized.Add(Obj);
+        return;
+    }
+
+    for (int32 y = Entry.MinCell.Y; y <= Entry.MaxCell.Y; y++)
+    {
+        for (int32 x = Entry.MinCell.X; x <= Entry.MaxCell.X; x++)
+            Cells.FindOrAdd(FIntPoint(x, y)).Add(Obj);
+    }
+}
+
+void FSpatialGrid::Unlink(UGObject* Obj, const FEntry& Entry)
+{
+    if (Entry.bOversized)
+    {
+        Oversized.RemoveSingleSwap(Obj, false);
+        return;
+    }
+
+    for (int32 y = Entry.MinCell.Y; y <= Entry.MaxCell.Y; y++)
+    {
+        for (int32 x = Entry.MinCell.X; x <= Entry.MaxCell.X; x++)
+        {
+            FIntPoint Key(x, y);
+            TArray<UGObject*>* Cell = Cells.Find(Key);
+            if (Cell != nullptr)
+            {
+                Cell->RemoveSingleSwap(Obj, false);
+                if (Cell->Num() == 0)
+                    Cells.Remove(Key);
+            }
+        }
+    }
+}
+
+void FSpatialGrid::Query(const FBox2D& Rect, TArray<UGObject*>& OutObjects) const
+{
+    FIntPoint QueryMin = ToCell(Rect.Min);
+    FIntPoint QueryMax = ToCell(Rect.Max);
+
+    //an object spanning several cells is reported only from the first of them inside the query
+    auto Visit = [&](const FIntPoint& Key, const TArray<UGObject*>& Cell)
+    {
+        for (UGObject* Obj : Cell)
+        {
+            const FEntry& Entry = Entries.FindChecked(Obj);
+            if (Key.X == FMath::Max(Entry.MinCell.X, QueryMin.X) && Key.Y == FMath::Max(Entry.MinCell.Y, QueryMin.Y)
+                && Entry.Rect.Intersect(Rect))
+                OutObjects.Add(Obj);
+        }
+    };
+
+    int64 Area = (int64)(QueryMax.X - QueryMin.X + 1) * (QueryMax.Y - QueryMin.Y + 1);
+    if (Area > Cells.Num())
+    {
+        for (auto& it : Cells)
+        {
+            if (it.Key.X >= QueryMin.X && it.Key.X <= QueryMax.X && it.Key.Y >= QueryMin.Y && it.Key.Y <= QueryMax.Y)
+                Visit(it.Key, it.Value);
+        }
+    }
+    else
+    {
+        for (int32 y = QueryMin.Y; y <= QueryMax.Y; y++)
+        {
+            for (int32 x = QueryMin.X; x <= QueryMax.X; x++)
+            {
+                FIntPoint Key(x, y);
+                const TArray<UGObject*>* Cell = Cells.Find(Key);
+                if (Cell != nullptr)
+                    Visit(Key, *Cell);
+            }
+        }
+    }
+
+    for (UGObject* Obj : Oversized)
+    {
+        if (Entries.FindChecked(Obj).Rect.Intersect(Rect))
+            OutObjects.Add(Obj);
+    }
+}
+
+void FSpatialGrid::QueryPoint(const FVector2D& Point, TArray<UGObject*>& OutObjects) const
+{
+    Query(FBox2D(Point, Point), OutObjects);
+}
+
+bool FSpatialGrid::GetBounds(FBox2D& OutBounds) const
+{
+    if (Entries.Num() == 0)
+        return false;
+
+    if (bBoundsDirty)
+    {
+        Bounds.Init();
+        for (auto& it : Entries)
+            Bounds += it.Value.Rect;
+        bBoundsDirty = false;
+    }
+
+    OutBounds = Bounds;
+    return true;
+}
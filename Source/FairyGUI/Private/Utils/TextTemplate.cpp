@@ -0,0 +1,142 @@
+#include "Utils/TextTemplate.h"
+
+FTextTemplate::FTextTemplate() :
+    bCompiled(false)
+{
+}
+
+void FTextTemplate::Reset()
+{
+    Source.Reset();
+    Spans.Reset();
+    Slots.Reset();
+    bCompiled = false;
+}
+
+void FTextTemplate::AddLiteral(int32 Start, int32 Length)
+{
+    if (Length <= 0)
+        return;
+
+    if (Spans.Num() > 0)
+    {
+        FSpan& Last = Spans.Last();
+        if (Last.Slot == INDEX_NONE && Last.Start + Last.Length == Start)
+        {
+            Last.Length += Length;
+            return;
+        }
+    }
+
+    Spans.Add({ Start, Length, INDEX_NONE });
+}
+
+void FTextTemplate::Compile(const FString& InSource, const TMap<FString, FString>& InVars)
+{
+    Reset();
+    Source = InSource;
+    bCompiled = true;
+
+    int32 pos1 = 0, pos2 = 0;
+    int32 len = Source.Len();
+    const TCHAR* Chars = *Source;
+
+    while ((pos2 = Source.Find(TEXT("{"), ESearchCase::CaseSensitive, ESearchDir::FromStart, pos1)) != -1)
+    {
+        if (pos2 > 0 && Chars[pos2 - 1] == '\\')
+        {
+            AddLiteral(pos1, pos2 - pos1 - 1);
+            AddLiteral(pos2, 1);
+            pos1 = pos2 + 1;
+            continue;
+        }
+
+        AddLiteral(pos1, pos2 - pos1);
+        pos1 = pos2;
+        pos2 = Source.Find(TEXT("}"), ESearchCase::CaseSensitive, ESearchDir::FromStart, pos1);
+        if (pos2 == -1)
+            break;
+
+        if (pos2 == pos1 + 1)
+        {
+            AddLiteral(pos1, 2);
+            pos1 = pos2 + 1;
+            continue;
+        }
+
+        FSlot Slot;
+        Slot.DefaultStart = pos2;
+        Slot.DefaultLength = 0;
+        int32 pos3 = pos1 + 1;
+        for (; pos3 < pos2; pos3++)
+        {
+            if (Chars[pos3] == '=')
+            {
+                Slot.DefaultStart = pos3 + 1;
+                Slot.DefaultLength = pos2 - pos3 - 1;
+                break;
+            }
+        }
+        Slot.Name = Source.Mid(pos1 + 1, pos3 - pos1 - 1);
+
+        const FString* Value = InVars.Find(Slot.Name);
+        Slot.bHasValue = Value != nullptr;
+        if (Value != nullptr)
+            Slot.Value = *Value;
+
+        Spans.Add({ 0, 0, Slots.Num() });
+        Slots.Add(MoveTemp(Slot));
+
+        pos1 = pos2 + 1;
+    }
+
+    AddLiteral(pos1, len - pos1);
+}
+
+bool FTextTemplate::SetVar(const FString& VarKey, const FString& VarValue)
+{
+    bool bUsed = false;
+    for (FSlot& Slot : Slots)
+    {
+        if (Slot.Name == VarKey)
+        {
+            Slot.Value = VarValue;
+            Slot.bHasValue = true;
+            bUsed = true;
+        }
+    }
+
+    return bUsed;
+}
+
+void FTextTemplate::Emit(FString& OutText) const
+{
+    int32 Length = 0;
+    for (const FSpan& Span : Spans)
+    {
+        if (Span.Slot == INDEX_NONE)
+            Length += Span.Length;
+        else
+        {
+            const FSlot& Slot = Slots[Span.Slot];
+            Length += Slot.bHasValue ? Slot.Value.Len() : Slot.DefaultLength;
+        }
+    }
+
+    OutText.Reset(Length);
+
+    const TCHAR* Chars = *Source;
+    for (const FSpan& Span : Spans)
+    {
+        if (Span.Slot == INDEX_NONE)
+            OutText.AppendChars(Chars + Span.Start, Span.Length);
+        else
+        {
+            const FSlot& Slot = Slots[Span.Slot];
+            if (Slot.bHasValue)
+                OutText.Append(Slot.Value);
+            else if (Slot.DefaultLength > 0)
+                OutText.AppendChars(Chars + Slot.DefaultStart, Slot.DefaultLength);
+        }
+    }
+}
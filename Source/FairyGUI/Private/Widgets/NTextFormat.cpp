@@ -2,6 +2,40 @@
 #include "UI/UIConfig.h"
 #include "UI/UIPackage.h"
 
+struct FTextStyleKey
+{
+    FString Face;
+    int32 Size;
+    FColor Color;
+    FColor OutlineColor;
+    int32 OutlineSize;
+    FColor ShadowColor;
+    FVector2D ShadowOffset;
+
+    bool operator==(const FTextStyleKey& Other) const
+    {
+        return Size == Other.Size && Color == Other.Color
+            && OutlineSize == Other.OutlineSize && OutlineColor == Other.OutlineColor
+            && ShadowColor == Other.ShadowColor && ShadowOffset == Other.ShadowOffset
+            && Face == Other.Face;
+    }
+
+    friend uint32 GetTypeHash(const FTextStyleKey& Key)
+    {
+        uint32 Hash = GetTypeHash(Key.Face);
+        Hash = HashCombine(Hash, GetTypeHash(Key.Size));
+        Hash = HashCombine(Hash, GetTypeHash(Key.Color));
+        Hash = HashCombine(Hash, GetTypeHash(Key.OutlineColor));
+        Hash = HashCombine(Hash, GetTypeHash(Key.OutlineSize));
+        Hash = HashCombine(Hash, GetTypeHash(Key.ShadowColor));
+        return HashCombine(Hash, GetTypeHash(Key.ShadowOffset));
+    }
+};
+
+//color tweens can produce a new style every frame, so the table is simply flushed when it grows too large
+static const int32 MAX_CACHED_STYLES = 1024;
+static TMap<FTextStyleKey, TSharedRef<const FTextBlockStyle>> StyleCache;
+
 FNTextFormat::FNTextFormat() :
     Size(12),
     Color(FColor::White),
@@ -30,9 +64,19 @@ bool FNTextFormat::EqualStyle(const FNTextFormat& AnotherFormat) const
 
 FTextBlockStyle FNTextFormat::GetStyle() const
 {
-    FTextBlockStyle Style;
+    return *GetSharedStyle();
+}
 
+TSharedRef<const FTextBlockStyle> FNTextFormat::GetSharedStyle() const
+{
     const FString& FontFace = Face.IsEmpty() ? FUIConfig::Config.DefaultFont : Face;
+
+    FTextStyleKey Key{ FontFace, Size, Color, OutlineColor, OutlineSize, ShadowColor, ShadowOffset };
+    const TSharedRef<const FTextBlockStyle>* Cached = StyleCache.Find(Key);
+    if (Cached != nullptr)
+        return *Cached;
+
+    TSharedRef<FTextBlockStyle> Style = MakeShareable(new FTextBlockStyle());
     if (!FontFace.StartsWith("ui://"))
     {
         const UObject* Font = UUIPackageStatic::Get().Fonts.FindRef(FontFace);
@@ -41,20 +85,29 @@ FTextBlockStyle FNTextFormat::GetStyle() const
             FSlateFontInfo SlateFont(Font, Size * 0.75f);
             SlateFont.OutlineSettings.OutlineSize = OutlineSize;
             SlateFont.OutlineSettings.OutlineColor = OutlineColor;
-            Style.SetFont(SlateFont);
+            Style->SetFont(SlateFont);
         }
         else
         {
             FSlateFontInfo SlateFont = FCoreStyle::GetDefaultFontStyle(*FontFace, Size * 0.75f);
             SlateFont.OutlineSettings.OutlineSize = OutlineSize;
             SlateFont.OutlineSettings.OutlineColor = OutlineColor;
-            Style.SetFont(SlateFont);
+            Style->SetFont(SlateFont);
         }
     }
 
-    Style.SetColorAndOpacity(FSlateColor(FLinearColor(Color)));
-    Style.SetShadowOffset(ShadowOffset);
-    Style.SetShadowColorAndOpacity(ShadowColor);
+    Style->SetColorAndOpacity(FSlateColor(FLinearColor(Color)));
+    Style->SetShadowOffset(ShadowOffset);
+    Style->SetShadowColorAndOpacity(ShadowColor);
 
-    return MoveTemp(Style);
+    if (StyleCache.Num() >= MAX_CACHED_STYLES)
+        StyleCache.Reset();
+    StyleCache.Add(MoveTemp(Key), Style);
+
+    return Style;
+}
+
+void FNTextFormat::ClearStyleCache()
+{
+    StyleCache.Reset();
 }
\ No newline at end of file
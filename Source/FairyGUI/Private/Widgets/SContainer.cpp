@@ -75,6 +75,26 @@ void SContainer::RemoveChildAt(int32 Index)
     Children.RemoveAt(Index);
 }
 
+void SContainer::AddChildren(const TArray<TSharedRef<SWidget>>& SlotWidgets)
+{
+    UGObject* OnStageObj = SDisplayObject::GetWidgetGObjectIfOnStage(AsShared());
+
+    for (auto& SlotWidget : SlotWidgets)
+    {
+        verifyf(!SlotWidget->GetParentWidget().IsValid(), TEXT("Cant add a child has parent"));
+
+        FSlotBase& NewSlot = *new FSlotBase();
+        Children.Add(&NewSlot);
+        NewSlot.AttachWidget(SlotWidget);
+    }
+
+    if (OnStageObj != nullptr)
+    {
+        for (auto& SlotWidget : SlotWidgets)
+            OnStageObj->GetApp()->BroadcastEvent(FUIEvents::AddedToStage, SlotWidget);
+    }
+}
+
 int32 SContainer::GetChildIndex(const TSharedRef<SWidget>& SlotWidget) const
 {
     for (int32 SlotIdx = 0; SlotIdx < Children.Num(); ++SlotIdx)
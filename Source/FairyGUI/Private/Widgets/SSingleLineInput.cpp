@@ -0,0 +1,657 @@
+#include "Widgets/SSingleLineInput.h"
+#include "Internationalization/Regex.h"
+#include "Framework/Application/SlateApplication.h"
+#include "HAL/PlatformApplicationMisc.h"
+#include "Styling/CoreStyle.h"
+
+static const float CARET_WIDTH = 1;
+static const FLinearColor SELECTION_COLOR(0.2f, 0.45f, 0.9f, 0.5f);
+
+class FSingleLineInputMethodContext : public ITextInputMethodContext
+{
+public:
+    FSingleLineInputMethodContext(SSingleLineInput* InOwner) :
+        Owner(InOwner)
+    {
+    }
+
+    void Detach()
+    {
+        Owner = nullptr;
+    }
+
+    virtual bool IsComposing() override
+    {
+        return Owner != nullptr && Owner->bComposing;
+    }
+
+    virtual bool IsReadOnly() override
+    {
+        return Owner == nullptr;
+    }
+
+    virtual uint32 GetTextLength() override
+    {
+        return Owner != nullptr ? Owner->InputText.Len() : 0;
+    }
+
+    virtual void GetSelectionRange(uint32& BeginIndex, uint32& Length, ECaretPosition& OutCaretPosition) override
+    {
+        if (Owner == nullptr)
+        {
+            BeginIndex = 0;
+            Length = 0;
+            OutCaretPosition = ECaretPosition::Ending;
+            return;
+        }
+
+        BeginIndex = FMath::Min(Owner->CaretPosition, Owner->SelectionAnchor);
+        Length = FMath::Abs(Owner->CaretPosition - Owner->SelectionAnchor);
+        OutCaretPosition = (Length > 0 && Owner->CaretPosition == BeginIndex) ? ECaretPosition::Beginning : ECaretPosition::Ending;
+    }
+
+    virtual void SetSelectionRange(const uint32 BeginIndex, const uint32 Length, const ECaretPosition InCaretPosition) override
+    {
+        if (Owner == nullptr)
+            return;
+
+        const int32 TextLength = Owner->InputText.Len();
+        const int32 Begin = FMath::Min((int32)BeginIndex, TextLength);
+        const int32 End = FMath::Min((int32)(BeginIndex + Length), TextLength);
+        if (InCaretPosition == ECaretPosition::Beginning)
+        {
+            Owner->CaretPosition = Begin;
+            Owner->SelectionAnchor = End;
+        }
+        else
+        {
+            Owner->CaretPosition = End;
+            Owner->SelectionAnchor = Begin;
+        }
+    }
+
+    virtual void GetTextInRange(const uint32 BeginIndex, const uint32 Length, FString& OutString) override
+    {
+        if (Owner != nullptr)
+            OutString = Owner->InputText.Mid(BeginIndex, Length);
+        else
+            OutString.Reset();
+    }
+
+    virtual void SetTextInRange(const uint32 BeginIndex, const uint32 Length, const FString& InString) override
+    {
+        //composition text is checked once the composition ends
+        if (Owner != nullptr)
+            Owner->ReplaceRange(BeginIndex, Length, InString, !Owner->bComposing);
+    }
+
+    virtual int32 GetCharacterIndexFromPoint(const FVector2D& Point) override
+    {
+        if (Owner == nullptr)
+            return INDEX_NONE;
+
+        return Owner->GetCharIndexAt(Owner->GetCachedGeometry(), Point);
+    }
+
+    virtual bool GetTextBounds(const uint32 BeginIndex, const uint32 Length, FVector2D& Position, FVector2D& Size) override
+    {
+        if (Owner == nullptr)
+            return false;
+
+        const FGeometry& Geometry = Owner->GetCachedGeometry();
+        const FVector2D Begin = Owner->GetCharLocation(BeginIndex);
+        const FVector2D End = Owner->GetCharLocation(BeginIndex + Length);
+        Position = Geometry.LocalToAbsolute(Begin);
+        Size = Geometry.LocalToAbsolute(FVector2D(End.X, Begin.Y + Owner->GetLineHeight())) - Position;
+        return false;
+    }
+
+    virtual void GetScreenBounds(FVector2D& Position, FVector2D& Size) override
+    {
+        if (Owner == nullptr)
+            return;
+
+        const FGeometry& Geometry = Owner->GetCachedGeometry();
+        Position = Geometry.GetAbsolutePosition();
+        Size = Geometry.GetAbsoluteSize();
+    }
+
+    virtual TSharedPtr<FGenericWindow> GetWindow() override
+    {
+        if (Owner == nullptr)
+            return nullptr;
+
+        TSharedPtr<SWindow> Window = FSlateApplication::Get().FindWidgetWindow(Owner->AsShared());
+        return Window.IsValid() ? Window->GetNativeWindow() : nullptr;
+    }
+
+    virtual void BeginComposition() override
+    {
+        if (Owner != nullptr && !Owner->bComposing)
+        {
+            Owner->bComposing = true;
+            Owner->CompositionBegin = Owner->CaretPosition;
+            Owner->CompositionLength = 0;
+        }
+    }
+
+    virtual void UpdateCompositionRange(const int32 InBeginIndex, const uint32 InLength) override
+    {
+        if (Owner != nullptr)
+        {
+            Owner->CompositionBegin = InBeginIndex;
+            Owner->CompositionLength = InLength;
+        }
+    }
+
+    virtual void EndComposition() override
+    {
+        if (Owner != nullptr && Owner->bComposing)
+        {
+            Owner->bComposing = false;
+            if (Owner->CompositionLength > 0)
+            {
+                FString Composed = Owner->InputText.Mid(Owner->CompositionBegin, Owner->CompositionLength);
+                Owner->ReplaceRange(Owner->CompositionBegin, Owner->CompositionLength, Composed, true);
+            }
+            Owner->CompositionLength = 0;
+        }
+    }
+
+private:
+    SSingleLineInput* Owner;
+};
+
+SSingleLineInput::SSingleLineInput() :
+    bPassword(false),
+    MaxLength(0),
+    CaretPosition(0),
+    SelectionAnchor(0),
+    bFocused(false),
+    bSelecting(false),
+    LastInputTime(0),
+    ScrollX(0),
+    bComposing(false),
+    CompositionBegin(0),
+    CompositionLength(0)
+{
+    bCanSupportFocus = true;
+    bSingleLine = true;
+}
+
+SSingleLineInput::~SSingleLineInput()
+{
+    if (TextInputMethodContext.IsValid())
+    {
+        ITextInputMethodSystem* TextInputMethodSystem = FSlateApplication::IsInitialized() ? FSlateApplication::Get().GetTextInputMethodSystem() : nullptr;
+        if (TextInputMethodSystem != nullptr && TextInputMethodChangeNotifier.IsValid())
+        {
+            TextInputMethodSystem->DeactivateContext(TextInputMethodContext.ToSharedRef());
+            TextInputMethodSystem->UnregisterContext(TextInputMethodContext.ToSharedRef());
+        }
+        StaticCastSharedPtr<FSingleLineInputMethodContext>(TextInputMethodContext)->Detach();
+    }
+}
+
+void SSingleLineInput::Construct(const FArguments& InArgs)
+{
+    STextField::Construct(STextField::FArguments().GObject(InArgs._GObject));
+
+    //The hosting STextInput is the display object of the GObject, keep this one out of the event chain
+    SetTag(NAME_None);
+}
+
+void SSingleLineInput::SetInputText(const FString& InText)
+{
+    const int32 OldLength = InputText.Len();
+
+    InputText = InText;
+    InputText.ReplaceInline(TEXT("\r"), TEXT(""));
+    InputText.ReplaceInline(TEXT("\n"), TEXT(""));
+    CaretPosition = SelectionAnchor = InputText.Len();
+    ScrollX = 0;
+    UpdateDisplayText();
+
+    NotifyTextChanged(0, OldLength, InputText.Len());
+}
+
+void SSingleLineInput::SetPrompt(const FString& InPrompt)
+{
+    Prompt = InPrompt;
+    UpdateDisplayText();
+}
+
+void SSingleLineInput::SetPassword(bool bInPassword)
+{
+    if (bPassword != bInPassword)
+    {
+        bPassword = bInPassword;
+        UpdateDisplayText();
+    }
+}
+
+void SSingleLineInput::SetMaxLength(int32 InMaxLength)
+{
+    MaxLength = FMath::Max(InMaxLength, 0);
+}
+
+void SSingleLineInput::SetRestrict(const FString& InRestrict)
+{
+    if (InRestrict.IsEmpty())
+        RestrictPattern.Reset();
+    else
+        RestrictPattern = MakeShared<FRegexPattern>(InRestrict);
+}
+
+void SSingleLineInput::SelectAll()
+{
+    SelectionAnchor = 0;
+    SetCaret(InputText.Len(), true);
+}
+
+void SSingleLineInput::UpdateDisplayText()
+{
+    if (InputText.IsEmpty() && !Prompt.IsEmpty() && !bFocused)
+        SetText(Prompt, true);
+    else if (bPassword)
+        SetText(FString::ChrN(InputText.Len(), TEXT('*')), false);
+    else
+        SetText(InputText, false);
+}
+
+void SSingleLineInput::ValidateInput(FString& InOutText, int32 InRemainLength) const
+{
+    //line breaks and other control characters never go into a single line
+    for (int32 i = InOutText.Len() - 1; i >= 0; i--)
+    {
+        TCHAR c = InOutText[i];
+        if (c < 0x20 || c == 0x7f)
+            InOutText.RemoveAt(i, 1, false);
+    }
+
+    if (RestrictPattern.IsValid() && !InOutText.IsEmpty())
+    {
+        FString Accepted;
+        FRegexMatcher Matcher(*RestrictPattern, InOutText);
+        while (Matcher.FindNext())
+        {
+            int32 Begin = Matcher.GetMatchBeginning();
+            int32 End = Matcher.GetMatchEnding();
+            if (End > Begin)
+                Accepted.Append(*InOutText + Begin, End - Begin);
+        }
+        InOutText = MoveTemp(Accepted);
+    }
+
+    if (MaxLength > 0 && InOutText.Len() > InRemainLength)
+        InOutText.LeftInline(FMath::Max(InRemainLength, 0), false);
+}
+
+void SSingleLineInput::ReplaceRange(int32 BeginIndex, int32 Length, const FString& InText, bool bValidate)
+{
+    BeginIndex = FMath::Clamp(BeginIndex, 0, InputText.Len());
+    Length = FMath::Clamp(Length, 0, InputText.Len() - BeginIndex);
+
+    FString NewText = InText;
+    if (bValidate)
+        ValidateInput(NewText, MaxLength - (InputText.Len() - Length));
+
+    if (Length == 0 && NewText.IsEmpty())
+    {
+        CaretPosition = SelectionAnchor = BeginIndex;
+        return;
+    }
+
+    InputText = InputText.Left(BeginIndex) + NewText + InputText.Mid(BeginIndex + Length);
+    CaretPosition = SelectionAnchor = BeginIndex + NewText.Len();
+    LastInputTime = FSlateApplication::Get().GetCurrentTime();
+    UpdateDisplayText();
+
+    OnTextChangedCallback.ExecuteIfBound(FText::FromString(InputText));
+}
+
+void SSingleLineInput::ReplaceSelection(const FString& InText)
+{
+    const int32 BeginIndex = FMath::Min(CaretPosition, SelectionAnchor);
+    const int32 Length = FMath::Abs(CaretPosition - SelectionAnchor);
+    const int32 OldLength = InputText.Len();
+
+    ReplaceRange(BeginIndex, Length, InText, true);
+
+    NotifyTextChanged(BeginIndex, Length, Length + InputText.Len() - OldLength);
+}
+
+void SSingleLineInput::NotifyTextChanged(int32 BeginIndex, int32 OldLength, int32 NewLength)
+{
+    if (TextInputMethodChangeNotifier.IsValid())
+    {
+        TextInputMethodChangeNotifier->NotifyTextChanged(BeginIndex, OldLength, NewLength);
+        TextInputMethodChangeNotifier->NotifySelectionChanged();
+    }
+}
+
+void SSingleLineInput::SetCaret(int32 InPosition, bool bExtendSelection)
+{
+    CaretPosition = FMath::Clamp(InPosition, 0, InputText.Len());
+    if (!bExtendSelection)
+        SelectionAnchor = CaretPosition;
+    LastInputTime = FSlateApplication::Get().GetCurrentTime();
+
+    if (TextInputMethodChangeNotifier.IsValid())
+        TextInputMethodChangeNotifier->NotifySelectionChanged();
+}
+
+int32 SSingleLineInput::GetCharIndexAt(const FGeometry& MyGeometry, const FVector2D& ScreenPosition) const
+{
+    const FVector2D LocalPosition = MyGeometry.AbsoluteToLocal(ScreenPosition) - GetTextOffset();
+    const FTextLocation Location = TextLayout->GetTextLocationAt(LocalPosition * TextLayout->GetScale());
+    return FMath::Clamp(Location.GetOffset(), 0, InputText.Len());
+}
+
+FVector2D SSingleLineInput::GetCharLocation(int32 Index) const
+{
+    return TextLayout->GetLocationAt(FTextLocation(0, Index), false) / TextLayout->GetScale() + GetTextOffset();
+}
+
+float SSingleLineInput::GetLineHeight() const
+{
+    const TArray<FTextLayout::FLineView>& LineViews = TextLayout->GetLineViews();
+    if (LineViews.Num() > 0)
+        return LineViews[0].Size.Y / TextLayout->GetScale();
+    else
+        return TextFormat.Size;
+}
+
+void SSingleLineInput::SetupLayout(const TSharedRef<FSlateTextLayout>& InLayout) const
+{
+    STextField::SetupLayout(InLayout);
+
+    //the alignment is applied by GetTextOffset, which also handles the scrolling
+    InLayout->SetJustification(ETextJustify::Left);
+}
+
+FVector2D SSingleLineInput::GetTextOffset() const
+{
+    FVector2D Offset(-ScrollX, 0);
+
+    //a scrolled text is wider than the box, alignment only applies to a shorter one
+    const float TextWidth = TextLayout->GetSize().X;
+    if (TextWidth < Size.X)
+    {
+        switch (TextFormat.Align)
+        {
+        case EAlignType::Center:
+            Offset.X = FMath::FloorToFloat((Size.X - TextWidth) * .5f);
+            break;
+
+        case EAlignType::Right:
+            Offset.X = FMath::Max(FMath::FloorToFloat(Size.X - TextWidth - CARET_WIDTH), 0.0f);
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    const float TextHeight = TextLayout->GetSize().Y;
+    switch (TextFormat.VerticalAlign)
+    {
+    case EVerticalAlignType::Middle:
+        Offset.Y = FMath::FloorToFloat((Size.Y - TextHeight) * .5f);
+        break;
+
+    case EVerticalAlignType::Bottom:
+        Offset.Y = FMath::FloorToFloat(Size.Y - TextHeight);
+        break;
+
+    default:
+        break;
+    }
+
+    if (Offset.Y < 0)
+        Offset.Y = 0;
+
+    return Offset;
+}
+
+FReply SSingleLineInput::OnFocusReceived(const FGeometry& MyGeometry, const FFocusEvent& InFocusEvent)
+{
+    bFocused = true;
+    LastInputTime = FSlateApplication::Get().GetCurrentTime();
+    UpdateDisplayText();
+
+    ITextInputMethodSystem* TextInputMethodSystem = FSlateApplication::Get().GetTextInputMethodSystem();
+    if (TextInputMethodSystem != nullptr)
+    {
+        if (!TextInputMethodContext.IsValid())
+            TextInputMethodContext = MakeShareable(new FSingleLineInputMethodContext(this));
+
+        TextInputMethodChangeNotifier = TextInputMethodSystem->RegisterContext(TextInputMethodContext.ToSharedRef());
+        TextInputMethodSystem->ActivateContext(TextInputMethodContext.ToSharedRef());
+    }
+
+    return FReply::Handled();
+}
+
+void SSingleLineInput::OnFocusLost(const FFocusEvent& InFocusEvent)
+{
+    ITextInputMethodSystem* TextInputMethodSystem = FSlateApplication::Get().GetTextInputMethodSystem();
+    if (TextInputMethodSystem != nullptr && TextInputMethodContext.IsValid() && TextInputMethodChangeNotifier.IsValid())
+    {
+        TextInputMethodSystem->DeactivateContext(TextInputMethodContext.ToSharedRef());
+        TextInputMethodSystem->UnregisterContext(TextInputMethodContext.ToSharedRef());
+    }
+    TextInputMethodChangeNotifier.Reset();
+
+    bFocused = false;
+    bSelecting = false;
+    bComposing = false;
+    CompositionLength = 0;
+    SelectionAnchor = CaretPosition;
+    UpdateDisplayText();
+
+    OnTextCommittedCallback.ExecuteIfBound(FText::FromString(InputText),
+        InFocusEvent.GetCause() == EFocusCause::Cleared ? ETextCommit::OnCleared : ETextCommit::OnUserMovedFocus);
+}
+
+FReply SSingleLineInput::OnKeyChar(const FGeometry& MyGeometry, const FCharacterEvent& InCharacterEvent)
+{
+    const TCHAR Character = InCharacterEvent.GetCharacter();
+    switch (Character)
+    {
+    case TEXT('\b'):
+        if (!HasSelection())
+        {
+            if (CaretPosition == 0)
+                return FReply::Handled();
+            SelectionAnchor = CaretPosition - 1;
+        }
+        ReplaceSelection(FString());
+        return FReply::Handled();
+
+    case TEXT('\n'):
+    case TEXT('\r'):
+        OnTextCommittedCallback.ExecuteIfBound(FText::FromString(InputText), ETextCommit::OnEnter);
+        return FReply::Handled();
+
+    default:
+        if (Character < 0x20 || Character == 0x7f)
+            return FReply::Unhandled();
+
+        ReplaceSelection(FString::Chr(Character));
+        return FReply::Handled();
+    }
+}
+
+FReply SSingleLineInput::OnKeyDown(const FGeometry& MyGeometry, const FKeyEvent& InKeyEvent)
+{
+    const FKey Key = InKeyEvent.GetKey();
+    const bool bShift = InKeyEvent.IsShiftDown();
+    const bool bCommand = InKeyEvent.IsControlDown() || InKeyEvent.IsCommandDown();
+
+    if (Key == EKeys::Left)
+    {
+        if (HasSelection() && !bShift)
+            SetCaret(FMath::Min(CaretPosition, SelectionAnchor), false);
+        else
+            SetCaret(CaretPosition - 1, bShift);
+        return FReply::Handled();
+    }
+    else if (Key == EKeys::Right)
+    {
+        if (HasSelection() && !bShift)
+            SetCaret(FMath::Max(CaretPosition, SelectionAnchor), false);
+        else
+            SetCaret(CaretPosition + 1, bShift);
+        return FReply::Handled();
+    }
+    else if (Key == EKeys::Home)
+    {
+        SetCaret(0, bShift);
+        return FReply::Handled();
+    }
+    else if (Key == EKeys::End)
+    {
+        SetCaret(InputText.Len(), bShift);
+        return FReply::Handled();
+    }
+    else if (Key == EKeys::Delete)
+    {
+        if (!HasSelection())
+        {
+            if (CaretPosition == InputText.Len())
+                return FReply::Handled();
+            SelectionAnchor = CaretPosition + 1;
+        }
+        ReplaceSelection(FString());
+        return FReply::Handled();
+    }
+    else if (Key == EKeys::Escape)
+    {
+        return FReply::Handled().ClearUserFocus(EFocusCause::Cleared);
+    }
+    else if (bCommand)
+    {
+        if (Key == EKeys::A)
+        {
+            SelectAll();
+            return FReply::Handled();
+        }
+        else if (Key == EKeys::C || Key == EKeys::X)
+        {
+            if (HasSelection() && !bPassword)
+            {
+                const int32 BeginIndex = FMath::Min(CaretPosition, SelectionAnchor);
+                FPlatformApplicationMisc::ClipboardCopy(*InputText.Mid(BeginIndex, FMath::Abs(CaretPosition - SelectionAnchor)));
+                if (Key == EKeys::X)
+                    ReplaceSelection(FString());
+            }
+            return FReply::Handled();
+        }
+        else if (Key == EKeys::V)
+        {
+            FString PastedText;
+            FPlatformApplicationMisc::ClipboardPaste(PastedText);
+            ReplaceSelection(PastedText);
+            return FReply::Handled();
+        }
+    }
+
+    return FReply::Unhandled();
+}
+
+FReply SSingleLineInput::OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+    FReply Reply = STextField::OnMouseButtonDown(MyGeometry, MouseEvent);
+    if (MouseEvent.GetEffectingButton() == EKeys::LeftMouseButton)
+    {
+        SetCaret(GetCharIndexAt(MyGeometry, MouseEvent.GetScreenSpacePosition()), MouseEvent.IsShiftDown());
+        bSelecting = true;
+
+        Reply.CaptureMouse(AsShared());
+        if (!bFocused)
+            Reply.SetUserFocus(AsShared(), EFocusCause::Mouse);
+    }
+    return Reply;
+}
+
+FReply SSingleLineInput::OnMouseButtonUp(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+    bSelecting = false;
+
+    return STextField::OnMouseButtonUp(MyGeometry, MouseEvent);
+}
+
+FReply SSingleLineInput::OnMouseMove(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+    if (bSelecting && HasMouseCapture())
+        SetCaret(GetCharIndexAt(MyGeometry, MouseEvent.GetScreenSpacePosition()), true);
+
+    return STextField::OnMouseMove(MyGeometry, MouseEvent);
+}
+
+FReply SSingleLineInput::OnMouseButtonDoubleClick(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+    FReply Reply = STextField::OnMouseButtonDoubleClick(MyGeometry, MouseEvent);
+    if (MouseEvent.GetEffectingButton() == EKeys::LeftMouseButton)
+        SelectAll();
+    return Reply;
+}
+
+int32 SSingleLineInput::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+    TextLayout->SetVisibleRegion(Size, FVector2D::ZeroVector);
+    TextLayout->UpdateIfNeeded();
+
+    //scroll horizontally to keep the caret inside the box
+    const float TextWidth = TextLayout->GetSize().X;
+    if (!bFocused || TextWidth <= Size.X)
+        ScrollX = 0;
+    else
+    {
+        const float CaretX = TextLayout->GetLocationAt(FTextLocation(0, CaretPosition), false).X / TextLayout->GetScale();
+        if (CaretX < ScrollX)
+            ScrollX = CaretX;
+        else if (CaretX - ScrollX > Size.X - CARET_WIDTH)
+            ScrollX = CaretX - Size.X + CARET_WIDTH;
+        ScrollX = FMath::Clamp(ScrollX, 0.0f, TextWidth - Size.X);
+    }
+
+    const FSlateBrush* Brush = FCoreStyle::Get().GetBrush("GenericWhiteBox");
+    const FLinearColor TextColor = FLinearColor(TextFormat.Color) * InWidgetStyle.GetColorAndOpacityTint();
+    const float LineHeight = GetLineHeight();
+
+    OutDrawElements.PushClip(FSlateClippingZone(AllottedGeometry));
+
+    if (bFocused && HasSelection())
+    {
+        const FVector2D Begin = GetCharLocation(FMath::Min(CaretPosition, SelectionAnchor));
+        const FVector2D End = GetCharLocation(FMath::Max(CaretPosition, SelectionAnchor));
+        FSlateDrawElement::MakeBox(OutDrawElements, LayerId,
+            AllottedGeometry.ToPaintGeometry(FVector2D(End.X - Begin.X, LineHeight), FSlateLayoutTransform(Begin)),
+            Brush, ESlateDrawEffect::None, SELECTION_COLOR * InWidgetStyle.GetColorAndOpacityTint());
+    }
+
+    LayerId = TextLayout->OnPaint(Args, AllottedGeometry.MakeChild(Size, FSlateLayoutTransform(GetTextOffset())),
+        MyCullingRect, OutDrawElements, LayerId + 1, InWidgetStyle, ShouldBeEnabled(bParentEnabled));
+
+    if (bComposing && CompositionLength > 0)
+    {
+        const FVector2D Begin = GetCharLocation(CompositionBegin);
+        const FVector2D End = GetCharLocation(CompositionBegin + CompositionLength);
+        FSlateDrawElement::MakeBox(OutDrawElements, LayerId,
+            AllottedGeometry.ToPaintGeometry(FVector2D(End.X - Begin.X, 1), FSlateLayoutTransform(FVector2D(Begin.X, Begin.Y + LineHeight - 1))),
+            Brush, ESlateDrawEffect::None, TextColor);
+    }
+
+    if (bFocused && FMath::Fmod((float)(FSlateApplication::Get().GetCurrentTime() - LastInputTime), 1.0f) < 0.5f)
+    {
+        FSlateDrawElement::MakeBox(OutDrawElements, LayerId,
+            AllottedGeometry.ToPaintGeometry(FVector2D(CARET_WIDTH, LineHeight), FSlateLayoutTransform(GetCharLocation(CaretPosition))),
+            Brush, ESlateDrawEffect::None, TextColor);
+    }
+
+    OutDrawElements.PopClip();
+
+    return LayerId;
+}
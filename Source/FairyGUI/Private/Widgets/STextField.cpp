@@ -1,19 +1,32 @@
 #include "Widgets/STextField.h"
 #include "Internationalization/BreakIterator.h"
+#include "Algo/BinarySearch.h"
 #include "Utils/HTMLParser.h"
 #include "Widgets/LoaderRun.h"
 #include "Widgets/BitmapFontRun.h"
 #include "UI/GObject.h"
+#include "UI/GComponent.h"
 #include "UI/UIPackage.h"
 
+static const float PARAGRAPH_MARGIN = 2;
+
 STextField::STextField() :
     bHTML(false),
     AutoSize(EAutoSizeType::None),
     bSingleLine(false),
     MaxWidth(0),
-    TextLayout(FSlateTextLayout::Create(this, FTextBlockStyle::GetDefault()))
+    TextLayout(FSlateTextLayout::Create(this, FTextBlockStyle::GetDefault())),
+    bVirtual(false),
+    MaxParagraphs(0),
+    EvictedInFirstSource(0),
+    OffsetDirtyIndex(INDEX_NONE),
+    BaseOffset(0),
+    LayoutWidth(0),
+    LayoutScale(1),
+    bSourceTextDirty(false)
 {
-    TextLayout->SetLineBreakIterator(FBreakIterator::CreateCharacterBoundaryIterator());
+    LineBreakIterator = FBreakIterator::CreateCharacterBoundaryIterator();
+    TextLayout->SetLineBreakIterator(LineBreakIterator);
 }
 
 void STextField::Construct(const FArguments& InArgs)
@@ -21,8 +34,40 @@ void STextField::Construct(const FArguments& InArgs)
     SDisplayObject::Construct(SDisplayObject::FArguments().GObject(InArgs._GObject));
 }
 
+const FString& STextField::GetText() const
+{
+    if (bSourceTextDirty)
+    {
+        STextField* This = const_cast<STextField*>(this);
+        This->bSourceTextDirty = false;
+        This->Text.Reset();
+        for (const FParagraphSource& Source : Sources)
+            This->Text.Append(Source.Text);
+    }
+
+    return Text;
+}
+
 void STextField::SetText(const FString& InText, bool bInHTML)
 {
+    if (bVirtual)
+    {
+        Paragraphs.Reset();
+        Sources.Reset();
+        EvictedInFirstSource = 0;
+        OffsetDirtyIndex = INDEX_NONE;
+        BaseOffset = 0;
+        bHTML = bInHTML;
+        bSourceTextDirty = true;
+        if (!InText.IsEmpty())
+        {
+            AddParagraphs(InText, bInHTML, true);
+            EvictParagraphs();
+        }
+        Invalidate(EInvalidateWidget::LayoutAndVolatility);
+        return;
+    }
+
     const int32 OldLength = Text.Len();
 
     // Only compare reasonably sized strings, it's not worth checking this
@@ -41,6 +86,52 @@ void STextField::SetText(const FString& InText, bool bInHTML)
     Invalidate(EInvalidateWidget::LayoutAndVolatility);
 }
 
+void STextField::SetVirtual(bool bInVirtual, int32 InMaxParagraphs)
+{
+    MaxParagraphs = InMaxParagraphs;
+    if (bVirtual == bInVirtual)
+    {
+        if (bVirtual && MaxParagraphs > 0 && Paragraphs.Num() > MaxParagraphs)
+        {
+            EvictParagraphs();
+            Invalidate(EInvalidateWidget::LayoutAndVolatility);
+        }
+        return;
+    }
+
+    FString CurrentText = GetText();
+    bVirtual = bInVirtual;
+    Paragraphs.Reset();
+    Sources.Reset();
+    EvictedInFirstSource = 0;
+    OffsetDirtyIndex = INDEX_NONE;
+    BaseOffset = 0;
+
+    TextLayout->ClearLines();
+    if (bVirtual)
+        TextLayout->UpdateIfNeeded();
+    else
+        TextLayout->DirtyLayout();
+    Text.Reset();
+    SetText(CurrentText, bHTML);
+}
+
+void STextField::AppendText(const FString& InText, bool bInHTML)
+{
+    if (!bVirtual)
+    {
+        SetText(Text + InText, bInHTML);
+        return;
+    }
+
+    if (InText.IsEmpty())
+        return;
+
+    AddParagraphs(InText, bInHTML, true);
+    EvictParagraphs();
+    Invalidate(EInvalidateWidget::LayoutAndVolatility);
+}
+
 void STextField::SetAutoSize(EAutoSizeType InAutoSize)
 {
     if (AutoSize != InAutoSize)
@@ -77,6 +168,16 @@ void STextField::SetMaxWidth(float InMaxWidth)
 
 FVector2D STextField::GetTextSize()
 {
+    if (bVirtual)
+    {
+        UpdateVirtualLayout();
+
+        float Height = PARAGRAPH_MARGIN * 2;
+        if (Paragraphs.Num() > 0)
+            Height += Paragraphs.Last().Offset + Paragraphs.Last().Height - BaseOffset;
+        return FVector2D(Size.X, Height);
+    }
+
     if(TextLayout->IsLayoutDirty())
         UpdateTextLayout();
 
@@ -93,7 +194,9 @@ void STextField::SetTextFormat(const FNTextFormat& InFormat)
 FVector2D STextField::ComputeDesiredSize(float LayoutScaleMultiplier) const
 {
     TextLayout->SetScale(LayoutScaleMultiplier);
-    if (TextLayout->IsLayoutDirty())
+    if (bVirtual)
+        const_cast<STextField*>(this)->UpdateVirtualLayout();
+    else if (TextLayout->IsLayoutDirty())
         const_cast<STextField*>(this)->UpdateTextLayout();
 
     return Size;
@@ -106,11 +209,34 @@ FChildren* STextField::GetChildren()
 
 void STextField::OnArrangeChildren(const FGeometry& AllottedGeometry, FArrangedChildren& ArrangedChildren) const
 {
-    TextLayout->ArrangeChildren(AllottedGeometry, ArrangedChildren);
+    if (!bVirtual)
+    {
+        TextLayout->ArrangeChildren(AllottedGeometry, ArrangedChildren);
+        return;
+    }
+
+    float Top, Bottom;
+    GetVisibleRange(Top, Bottom);
+
+    int32 Index = Algo::UpperBoundBy(Paragraphs, Top, [this](const FParagraph& Paragraph) {
+        return PARAGRAPH_MARGIN + Paragraph.Offset - BaseOffset + Paragraph.Height;
+    });
+    for (; Index < Paragraphs.Num(); Index++)
+    {
+        const FParagraph& Paragraph = Paragraphs[Index];
+        float Y = PARAGRAPH_MARGIN + Paragraph.Offset - BaseOffset;
+        if (Y >= Bottom)
+            break;
+
+        Paragraph.Layout->ArrangeChildren(AllottedGeometry.MakeChild(FVector2D(Size.X, Paragraph.Height), FSlateLayoutTransform(FVector2D(0, Y))), ArrangedChildren);
+    }
 }
 
 int32 STextField::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
 {
+    if (bVirtual)
+        return PaintParagraphs(Args, AllottedGeometry, MyCullingRect, OutDrawElements, LayerId, InWidgetStyle, bParentEnabled);
+
     FVector2D AutoScrollValue = FVector2D::ZeroVector; // Scroll to the left
     if (TextFormat.Align != EAlignType::Left)
     {
@@ -167,31 +293,14 @@ void STextField::UpdateTextLayout()
     TextLayout->ClearLineHighlights();
     TextLayout->ClearRunRenderers();
 
-    TextLayout->SetDefaultTextStyle(TextFormat.GetStyle());
-    TextLayout->SetJustification((ETextJustify::Type)TextFormat.Align);
-    TextLayout->SetWrappingPolicy(ETextWrappingPolicy::AllowPerCharacterWrapping);
-    if (AutoSize == EAutoSizeType::Both)
-        TextLayout->SetWrappingWidth(MaxWidth);
-    else
-        TextLayout->SetWrappingWidth(MaxWidth != 0 ? FMath::Min(MaxWidth, Size.X) : Size.X);
-    TextLayout->SetMargin(FMargin(2, 2));
-    TextLayout->SetLineHeightPercentage(1 + (TextFormat.LineSpacing - 3) / TextFormat.Size);
+    SetupLayout(TextLayout);
 
     HTMLElements.Reset();
-    if (bHTML)
-    {
-        FHTMLParser::DefaultParser.Parse(Text, TextFormat, HTMLElements, FHTMLParser::DefaultParseOptions);
-    }
-    else
-    {
-        FHTMLElement TextElement;
-        TextElement.Type = EHTMLElementType::Text;
-        TextElement.Format = TextFormat;
-        TextElement.Text = Text;
-        HTMLElements.Add(MoveTemp(TextElement));
-    }
+    ParseElements(Text, bHTML, HTMLElements);
 
-    BuildLines();
+    TArray<FTextLayout::FNewLineData> Lines;
+    BuildLines(HTMLElements, Lines);
+    TextLayout->AddLines(Lines);
 
     TextLayout->UpdateIfNeeded();
 
@@ -205,7 +314,38 @@ void STextField::UpdateTextLayout()
     }
 }
 
-void STextField::BuildLines()
+void STextField::SetupLayout(const TSharedRef<FSlateTextLayout>& InLayout) const
+{
+    InLayout->SetDefaultTextStyle(*TextFormat.GetSharedStyle());
+    InLayout->SetJustification((ETextJustify::Type)TextFormat.Align);
+    InLayout->SetWrappingPolicy(ETextWrappingPolicy::AllowPerCharacterWrapping);
+    if (bSingleLine)
+        InLayout->SetWrappingWidth(0);
+    else if (AutoSize == EAutoSizeType::Both && !bVirtual)
+        InLayout->SetWrappingWidth(MaxWidth);
+    else
+        InLayout->SetWrappingWidth(MaxWidth != 0 ? FMath::Min(MaxWidth, Size.X) : Size.X);
+    InLayout->SetMargin(FMargin(2, 2));
+    InLayout->SetLineHeightPercentage(1 + (TextFormat.LineSpacing - 3) / TextFormat.Size);
+}
+
+void STextField::ParseElements(const FString& InText, bool bInHTML, TArray<FHTMLElement>& OutElements) const
+{
+    if (bInHTML)
+    {
+        FHTMLParser::DefaultParser.Parse(InText, TextFormat, OutElements, FHTMLParser::DefaultParseOptions);
+    }
+    else
+    {
+        FHTMLElement TextElement;
+        TextElement.Type = EHTMLElementType::Text;
+        TextElement.Format = TextFormat;
+        TextElement.Text = InText;
+        OutElements.Add(MoveTemp(TextElement));
+    }
+}
+
+void STextField::BuildLines(const TArray<FHTMLElement>& InElements, TArray<FTextLayout::FNewLineData>& OutLines) const
 {
     class FLineHelper
     {
@@ -264,14 +404,16 @@ void STextField::BuildLines()
     }
 
     TArray<FTextRange> LineRangesBuffer;
-    for (int32 ElementIndex = 0; ElementIndex < HTMLElements.Num(); ++ElementIndex)
+    TSharedPtr<const FTextBlockStyle> TextStyle;
+    for (int32 ElementIndex = 0; ElementIndex < InElements.Num(); ++ElementIndex)
     {
-        const FHTMLElement& Element = HTMLElements[ElementIndex];
+        const FHTMLElement& Element = InElements[ElementIndex];
         if (Element.Type == EHTMLElementType::Text)
         {
             LineRangesBuffer.Reset();
 
-            FTextBlockStyle TextStyle = Element.Format.GetStyle();
+            if (!BitmapFont.IsValid())
+                TextStyle = Element.Format.GetSharedStyle();
 
             FTextRange::CalculateLineRangesFromString(Element.Text, LineRangesBuffer);
 
@@ -298,7 +440,7 @@ void STextField::BuildLines()
                     LineHelper.GetText().Append(TextBlock);
                     ModelRange.EndIndex = LineHelper.GetText().Len();
 
-                    LineHelper.GetRuns().Add(FSlateTextRun::Create(FRunInfo(), LineHelper.GetTextRef(), TextStyle, ModelRange));
+                    LineHelper.GetRuns().Add(FSlateTextRun::Create(FRunInfo(), LineHelper.GetTextRef(), *TextStyle, ModelRange));
                 }
 
                 if (LineIndex != LineRangesBuffer.Num() - 1)
@@ -315,5 +457,245 @@ void STextField::BuildLines()
         }
     }
 
-    TextLayout->AddLines(LineHelper.Lines);
+    OutLines = MoveTemp(LineHelper.Lines);
+}
+
+void STextField::AddParagraphs(const FString& InText, bool bInHTML, bool bMeasure)
+{
+    HTMLElements.Reset();
+    ParseElements(InText, bInHTML, HTMLElements);
+
+    TArray<FTextLayout::FNewLineData> Lines;
+    BuildLines(HTMLElements, Lines);
+    HTMLElements.Reset();
+
+    //a trailing line break terminates the last paragraph instead of opening an empty one
+    if (Lines.Num() > 1 && Lines.Last().Text->IsEmpty())
+        Lines.Pop(false);
+
+    float EstimatedHeight = Paragraphs.Num() > 0 ? Paragraphs.Last().Height : TextFormat.Size + TextFormat.LineSpacing;
+    if (OffsetDirtyIndex == INDEX_NONE)
+        OffsetDirtyIndex = Paragraphs.Num();
+
+    for (FTextLayout::FNewLineData& Line : Lines)
+    {
+        TSharedRef<FSlateTextLayout> Layout = FSlateTextLayout::Create(this, FTextBlockStyle::GetDefault());
+        Layout->SetLineBreakIterator(LineBreakIterator);
+        SetupLayout(Layout);
+        Layout->SetMargin(FMargin(PARAGRAPH_MARGIN, 0));
+        Layout->SetScale(LayoutScale);
+        Layout->AddLine(Line);
+
+        FParagraph& Paragraph = Paragraphs[Paragraphs.Emplace(Layout)];
+        if (bMeasure)
+        {
+            //new text is laid out once here, so appending stays proportional to the appended text
+            Layout->UpdateIfNeeded();
+            Paragraph.Height = Layout->GetSize().Y;
+            Paragraph.bMeasured = true;
+        }
+        else
+            Paragraph.Height = EstimatedHeight;
+    }
+
+    Sources.Add({ InText, bInHTML, Lines.Num() });
+    bSourceTextDirty = true;
+}
+
+void STextField::EvictParagraphs()
+{
+    if (MaxParagraphs <= 0 || Paragraphs.Num() <= MaxParagraphs)
+        return;
+
+    int32 Count = Paragraphs.Num() - MaxParagraphs;
+    Paragraphs.RemoveAt(0, Count, false);
+
+    int32 Remaining = Count;
+    int32 SourceCount = 0;
+    while (Remaining > 0)
+    {
+        int32 Left = Sources[SourceCount].ParagraphCount - EvictedInFirstSource;
+        if (Remaining >= Left)
+        {
+            Remaining -= Left;
+            EvictedInFirstSource = 0;
+            SourceCount++;
+        }
+        else
+        {
+            EvictedInFirstSource += Remaining;
+            Remaining = 0;
+        }
+    }
+    Sources.RemoveAt(0, SourceCount, false);
+    bSourceTextDirty = true;
+
+    if (OffsetDirtyIndex != INDEX_NONE)
+        OffsetDirtyIndex = FMath::Max(0, OffsetDirtyIndex - Count);
+    if (OffsetDirtyIndex != 0 && Paragraphs.Num() > 0)
+        BaseOffset = Paragraphs[0].Offset;
+}
+
+void STextField::RebuildParagraphs()
+{
+    TArray<FParagraphSource> OldSources = MoveTemp(Sources);
+    TArray<float> OldHeights;
+    OldHeights.Reserve(Paragraphs.Num());
+    for (const FParagraph& Paragraph : Paragraphs)
+        OldHeights.Add(Paragraph.Height);
+    int32 Skip = EvictedInFirstSource;
+
+    Paragraphs.Reset();
+    Sources.Reset();
+    EvictedInFirstSource = 0;
+    OffsetDirtyIndex = INDEX_NONE;
+    BaseOffset = 0;
+
+    //runs are rebuilt with the new format, but shaping is left to UpdateVirtualLayout for the paragraphs in view
+    for (const FParagraphSource& Source : OldSources)
+        AddParagraphs(Source.Text, Source.bHTML, false);
+
+    if (Skip > 0)
+    {
+        Paragraphs.RemoveAt(0, FMath::Min(Skip, Paragraphs.Num()), false);
+        EvictedInFirstSource = Skip;
+    }
+
+    for (int32 i = 0; i < Paragraphs.Num() && i < OldHeights.Num(); i++)
+        Paragraphs[i].Height = OldHeights[i];
+    OffsetDirtyIndex = 0;
+}
+
+void STextField::UpdateVirtualLayout()
+{
+    if (TextLayout->IsLayoutDirty())
+    {
+        TextLayout->ClearLines();
+        TextLayout->UpdateIfNeeded();
+        RebuildParagraphs();
+    }
+
+    float WrappingWidth = MaxWidth != 0 ? FMath::Min(MaxWidth, Size.X) : Size.X;
+    float Scale = TextLayout->GetScale();
+    if (WrappingWidth != LayoutWidth || Scale != LayoutScale)
+    {
+        LayoutWidth = WrappingWidth;
+        LayoutScale = Scale;
+        for (FParagraph& Paragraph : Paragraphs)
+        {
+            Paragraph.Layout->SetWrappingWidth(LayoutWidth);
+            Paragraph.Layout->SetScale(LayoutScale);
+            Paragraph.bMeasured = false;
+        }
+    }
+
+    if (OffsetDirtyIndex != INDEX_NONE)
+    {
+        for (int32 i = OffsetDirtyIndex; i < Paragraphs.Num(); i++)
+            Paragraphs[i].Offset = i == 0 ? BaseOffset : Paragraphs[i - 1].Offset + Paragraphs[i - 1].Height;
+        OffsetDirtyIndex = INDEX_NONE;
+    }
+
+    float Top, Bottom;
+    GetVisibleRange(Top, Bottom);
+
+    int32 Index = Algo::UpperBoundBy(Paragraphs, Top, [this](const FParagraph& Paragraph) {
+        return PARAGRAPH_MARGIN + Paragraph.Offset - BaseOffset + Paragraph.Height;
+    });
+    if (Index < Paragraphs.Num())
+    {
+        bool bChanged = false;
+        float Offset = Paragraphs[Index].Offset;
+        for (; Index < Paragraphs.Num(); Index++)
+        {
+            FParagraph& Paragraph = Paragraphs[Index];
+            Paragraph.Offset = Offset;
+            if (PARAGRAPH_MARGIN + Offset - BaseOffset >= Bottom)
+                break;
+
+            if (!Paragraph.bMeasured)
+            {
+                Paragraph.Layout->UpdateIfNeeded();
+                float Height = Paragraph.Layout->GetSize().Y;
+                if (Height != Paragraph.Height)
+                {
+                    Paragraph.Height = Height;
+                    bChanged = true;
+                }
+                Paragraph.bMeasured = true;
+            }
+            Offset += Paragraph.Height;
+        }
+
+        if (bChanged)
+        {
+            for (; Index < Paragraphs.Num(); Index++)
+                Paragraphs[Index].Offset = Paragraphs[Index - 1].Offset + Paragraphs[Index - 1].Height;
+        }
+    }
+
+    if (AutoSize != EAutoSizeType::None && GObject.IsValid())
+    {
+        float Height = PARAGRAPH_MARGIN * 2;
+        if (Paragraphs.Num() > 0)
+            Height += Paragraphs.Last().Offset + Paragraphs.Last().Height - BaseOffset;
+        if (Height != Size.Y)
+            GObject->SetSize(FVector2D(Size.X, Height));
+    }
+}
+
+void STextField::GetVisibleRange(float& OutTop, float& OutBottom) const
+{
+    OutTop = 0;
+    OutBottom = Size.Y;
+
+    UGObject* Obj = GObject.Get();
+    float Offset = 0;
+    while (Obj != nullptr)
+    {
+        UGComponent* Parent = Obj->GetParent();
+        if (Parent == nullptr)
+            break;
+
+        Offset += Obj->GetY();
+        UScrollPane* ScrollPane = Parent->GetScrollPane();
+        if (ScrollPane != nullptr)
+        {
+            OutTop = ScrollPane->GetScrollingPosY() - Offset;
+            OutBottom = OutTop + ScrollPane->GetViewSize().Y;
+            return;
+        }
+
+        Offset += Parent->GetMargin().Top;
+        Obj = Parent;
+    }
+}
+
+int32 STextField::PaintParagraphs(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+    //the culling rect is already clipped by the mask of the owning scroll pane
+    FVector2D CullTop = AllottedGeometry.AbsoluteToLocal(MyCullingRect.GetTopLeft());
+    FVector2D CullBottom = AllottedGeometry.AbsoluteToLocal(MyCullingRect.GetBottomRight());
+    float Top = FMath::Min(CullTop.Y, CullBottom.Y);
+    float Bottom = FMath::Max(CullTop.Y, CullBottom.Y);
+
+    int32 MaxLayerId = LayerId;
+    int32 Index = Algo::UpperBoundBy(Paragraphs, Top, [this](const FParagraph& Paragraph) {
+        return PARAGRAPH_MARGIN + Paragraph.Offset - BaseOffset + Paragraph.Height;
+    });
+    for (; Index < Paragraphs.Num(); Index++)
+    {
+        const FParagraph& Paragraph = Paragraphs[Index];
+        float Y = PARAGRAPH_MARGIN + Paragraph.Offset - BaseOffset;
+        if (Y >= Bottom)
+            break;
+
+        Paragraph.Layout->SetVisibleRegion(FVector2D(Size.X, Paragraph.Height), FVector2D::ZeroVector);
+        Paragraph.Layout->UpdateIfNeeded();
+
+        const FGeometry ParagraphGeometry = AllottedGeometry.MakeChild(FVector2D(Size.X, Paragraph.Height), FSlateLayoutTransform(FVector2D(0, Y)));
+        MaxLayerId = FMath::Max(MaxLayerId, Paragraph.Layout->OnPaint(Args, ParagraphGeometry, MyCullingRect, OutDrawElements, LayerId, InWidgetStyle, ShouldBeEnabled(bParentEnabled)));
+    }
+
+    return MaxLayerId;
 }
\ No newline at end of file
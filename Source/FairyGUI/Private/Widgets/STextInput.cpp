@@ -1,5 +1,8 @@
 #include "Widgets/STextInput.h"
 #include "Widgets/Text/SlateEditableTextLayout.h"
+#include "Widgets/SSingleLineInput.h"
+#include "HAL/PlatformApplicationMisc.h"
+#include "Utils/UBBParser.h"
 
 class SMyTextInput : public SMultiLineEditableText
 {
@@ -39,53 +42,179 @@ public:
 };
 
 STextInput::STextInput() :
-    Widget(SNew(SMyTextInput)),
-    ChildSlot(this)
+    ChildSlot(this),
+    bSingleLine(false),
+    bPassword(false),
+    MaxLength(0)
 {
 }
 
 void STextInput::Construct(const FArguments& InArgs)
 {
     SDisplayObject::Construct(SDisplayObject::FArguments().GObject(InArgs._GObject));
+}
+
+bool STextInput::UsesSingleLineWidget() const
+{
+    //SSingleLineInput doesn't drive the virtual keyboard, those platforms keep the multi-line editor
+    return bSingleLine && !FPlatformApplicationMisc::RequiresVirtualKeyboard();
+}
+
+TSharedRef<SWidget> STextInput::GetWidget()
+{
+    if (UsesSingleLineWidget())
+    {
+        if (!SingleLineWidget.IsValid())
+        {
+            FString CurrentText;
+            if (Widget.IsValid())
+            {
+                CurrentText = Widget->GetText().ToString();
+                Widget.Reset();
+            }
+
+            SAssignNew(SingleLineWidget, SSingleLineInput).GObject(GObject.Get());
+            SingleLineWidget->SetTextFormat(TextFormat);
+            SingleLineWidget->SetPassword(bPassword);
+            SingleLineWidget->SetMaxLength(MaxLength);
+            SingleLineWidget->SetRestrict(Restrict);
+            SingleLineWidget->SetPrompt(FUBBParser::DefaultParser.Parse(Prompt));
+            SingleLineWidget->SetOnTextChanged(OnTextChangedCallback);
+            SingleLineWidget->SetOnTextCommitted(OnTextCommittedCallback);
+            SingleLineWidget->SetInputText(CurrentText);
+            ChildSlot.AttachWidget(SingleLineWidget.ToSharedRef());
+        }
+
+        return SingleLineWidget.ToSharedRef();
+    }
+    else
+    {
+        if (!Widget.IsValid())
+        {
+            FString CurrentText;
+            if (SingleLineWidget.IsValid())
+            {
+                CurrentText = SingleLineWidget->GetInputText();
+                SingleLineWidget.Reset();
+            }
+
+            TSharedRef<SMyTextInput> Editor = SNew(SMyTextInput);
+            Editor->SetTextFormat(TextFormat);
+            Editor->bPassword = bPassword;
+            Editor->SetHintText(FText::FromString(FUBBParser::DefaultParser.Parse(Prompt, true)));
+            Editor->SetOnTextChanged(OnTextChangedCallback);
+            Editor->SetOnTextCommitted(OnTextCommittedCallback);
+            Editor->SetText(FText::FromString(CurrentText));
+            Editor->SetAllowMultiLine(!bSingleLine);
+            Widget = Editor;
+            ChildSlot.AttachWidget(Editor);
+        }
+
+        return Widget.ToSharedRef();
+    }
+}
+
+void STextInput::SetText(const FString& InText)
+{
+    GetWidget();
+
+    if (SingleLineWidget.IsValid())
+        SingleLineWidget->SetInputText(InText);
+    else
+        Widget->SetText(FText::FromString(InText));
+}
+
+void STextInput::SetPrompt(const FString& InPrompt)
+{
+    Prompt = InPrompt;
 
-    ChildSlot.AttachWidget(Widget);
+    if (SingleLineWidget.IsValid())
+        SingleLineWidget->SetPrompt(FUBBParser::DefaultParser.Parse(Prompt));
+    else if (Widget.IsValid())
+        Widget->SetHintText(FText::FromString(FUBBParser::DefaultParser.Parse(Prompt, true)));
 }
 
 void STextInput::SetTextFormat(const FNTextFormat& InTextFormat)
 {
-    StaticCastSharedRef<SMyTextInput>(Widget)->SetTextFormat(InTextFormat);
+    TextFormat = InTextFormat;
+
+    if (SingleLineWidget.IsValid())
+        SingleLineWidget->SetTextFormat(TextFormat);
+    else if (Widget.IsValid())
+        StaticCastSharedPtr<SMyTextInput>(Widget)->SetTextFormat(TextFormat);
 }
 
 void STextInput::SetPassword(bool bInPassword)
 {
-    StaticCastSharedRef<SMyTextInput>(Widget)->bPassword = bInPassword;
+    bPassword = bInPassword;
+
+    if (SingleLineWidget.IsValid())
+        SingleLineWidget->SetPassword(bPassword);
+    else if (Widget.IsValid())
+        StaticCastSharedPtr<SMyTextInput>(Widget)->bPassword = bPassword;
 }
 
 void STextInput::SetSingleLine(bool bInSingleLine)
 {
-    StaticCastSharedRef<SMyTextInput>(Widget)->SetAllowMultiLine(!bInSingleLine);
+    if (bSingleLine != bInSingleLine)
+    {
+        bSingleLine = bInSingleLine;
+        if (SingleLineWidget.IsValid() || Widget.IsValid())
+            GetWidget();
+        if (Widget.IsValid())
+            StaticCastSharedPtr<SMyTextInput>(Widget)->SetAllowMultiLine(!bSingleLine);
+    }
+}
+
+void STextInput::SetMaxLength(int32 InMaxLength)
+{
+    MaxLength = InMaxLength;
+
+    if (SingleLineWidget.IsValid())
+        SingleLineWidget->SetMaxLength(MaxLength);
+}
+
+void STextInput::SetRestrict(const FString& InRestrict)
+{
+    Restrict = InRestrict;
+
+    if (SingleLineWidget.IsValid())
+        SingleLineWidget->SetRestrict(Restrict);
 }
 
 void STextInput::SetOnTextChanged(FOnTextChanged Callback)
 {
-    StaticCastSharedRef<SMyTextInput>(Widget)->SetOnTextChanged(Callback);
+    OnTextChangedCallback = Callback;
+
+    if (SingleLineWidget.IsValid())
+        SingleLineWidget->SetOnTextChanged(Callback);
+    else if (Widget.IsValid())
+        StaticCastSharedPtr<SMyTextInput>(Widget)->SetOnTextChanged(Callback);
 }
 
 void STextInput::SetOnTextCommitted(FOnTextCommitted Callback)
 {
-    StaticCastSharedRef<SMyTextInput>(Widget)->SetOnTextCommitted(Callback);
+    OnTextCommittedCallback = Callback;
+
+    if (SingleLineWidget.IsValid())
+        SingleLineWidget->SetOnTextCommitted(Callback);
+    else if (Widget.IsValid())
+        StaticCastSharedPtr<SMyTextInput>(Widget)->SetOnTextCommitted(Callback);
 }
 
 FChildren* STextInput::GetChildren()
 {
+    GetWidget();
+
     return &ChildSlot;
 }
 
 void STextInput::OnArrangeChildren(const FGeometry& AllottedGeometry, FArrangedChildren& ArrangedChildren) const
 {
-    if (ArrangedChildren.Accepts(Widget->GetVisibility()))
+    const TSharedRef<SWidget>& Child = ChildSlot.GetWidget();
+    if (Child != SNullWidget::NullWidget && ArrangedChildren.Accepts(Child->GetVisibility()))
         ArrangedChildren.AddWidget(AllottedGeometry.MakeChild(
-            Widget, FVector2D::ZeroVector, Size
+            Child, FVector2D::ZeroVector, Size
         ));
 }
 
@@ -93,6 +222,8 @@ int32 STextInput::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeome
 {
     FArrangedChildren ArrangedChildren(EVisibility::Visible);
     ArrangeChildren(AllottedGeometry, ArrangedChildren);
+    if (ArrangedChildren.Num() == 0)
+        return LayerId;
 
     FArrangedWidget& TheChild = ArrangedChildren[0];
     return TheChild.Widget->Paint(Args.WithNewParent(this), TheChild.Geometry, MyCullingRect, OutDrawElements, LayerId, InWidgetStyle, ShouldBeEnabled(bParentEnabled));
@@ -23,6 +23,7 @@ struct FAIRYGUI_API FUIEvents
 
     static const FName Changed;
     static const FName ClickItem;
+    static const FName ItemDeferredRenderComplete;
     static const FName ClickLink;
     static const FName GearStop;
 
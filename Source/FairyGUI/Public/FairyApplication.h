@@ -16,6 +16,7 @@ class UNTexture;
 class UGObject;
 class UGRoot;
 class UDragDropManager;
+class UScrollPane;
 
 UCLASS(BlueprintType)
 class FAIRYGUI_API UFairyApplication : public UObject
@@ -118,6 +119,14 @@ public:
 
     void CallAfterSlateTick(FSimpleDelegate Callback);
 
+    FTweenManager& GetTweenManager() { return TweenManager.IsValid() ? *TweenManager : FTweenManager::Singleton; }
+
+    //flushed before the next Slate tick, see UGObject::StagePosition
+    void AddStagedObject(UGObject* Obj) { StagedObjects.Add(Obj); }
+
+    void AddTickingScrollPane(UScrollPane* Pane);
+    void RemoveTickingScrollPane(UScrollPane* Pane);
+
     template< class UserClass, typename... VarTypes >
     void DelayCall(FTimerHandle& InOutHandle, UserClass* InUserObject, typename TMemFunPtrType<false, UserClass, void(VarTypes...)>::Type inTimerMethod, VarTypes...);
     void CancelDelayCall(FTimerHandle& InHandle);
@@ -138,6 +147,7 @@ private:
     FTouchInfo* GetTouchInfo(const FPointerEvent& MouseEvent);
     FTouchInfo* GetTouchInfo(int32 InUserIndex, int32 InPointerIndex);
 
+    void OnSlatePreTick(float DeltaTime);
     void OnSlatePostTick(float DeltaTime);
 
 private:
@@ -154,10 +164,15 @@ private:
     TIndirectArray<FTouchInfo> Touches;
     FTouchInfo* LastTouch;
     bool bNeedCheckPopups;
+    FDelegateHandle PreTickDelegateHandle;
     FDelegateHandle PostTickDelegateHandle;
     FSimpleMulticastDelegate PostTickMulticastDelegate;
+    TArray<TWeakObjectPtr<UScrollPane>> TickingScrollPanes;
+    TArray<TWeakObjectPtr<UScrollPane>> TickingScrollPanesCopy;
+    TArray<TWeakObjectPtr<UGObject>> StagedObjects;
     bool bSoundEnabled;
     float SoundVolumeScale;
+    TUniquePtr<FTweenManager> TweenManager;
 
     UGameInstance* GameInstance;
 
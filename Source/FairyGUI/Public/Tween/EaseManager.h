@@ -6,5 +6,12 @@
 class FAIRYGUI_API EaseManager
 {
 public:
+    //Reads a sampled table for the sine, expo and elastic eases when FUIConfig::EaseTableResolution is set,
+    //otherwise same as EvaluateExact.
     static float Evaluate(EEaseType EaseType, float Time, float Duration, float OvershootOrAmplitude, float Period);
+    static float EvaluateExact(EEaseType EaseType, float Time, float Duration, float OvershootOrAmplitude, float Period);
+
+    //Eases Count normalized times in place. The polynomial and sine eases run as plain loops over the
+    //array, the others fall back to Evaluate with the default overshoot and period.
+    static void EvaluateBatch(EEaseType EaseType, float* Times, int32 Count);
 };
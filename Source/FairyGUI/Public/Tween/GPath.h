@@ -31,6 +31,12 @@ public:
     void Clear();
     FVector GetPointAt(float Time);
 
+    //Samples the curves by arc length so that GetPointAt moves at constant speed, e.g. for a tween using
+    //this path. Lookups walk forward from the previous one, so increasing times cost O(1).
+    //Create and Clear drop the table.
+    void BuildArcLengthTable(int32 SamplesPerSegment = 32);
+    bool HasArcLengthTable() const { return ArcSamples.Num() > 0; }
+
     float GetLength() { return FullLength; }
     int32 GetSegmentCount() { return Segments.Num(); }
     float GetSegmentLength(int32 SegmentIndex);
@@ -50,8 +56,20 @@ private:
     void CreateSplineSegment(TArray<FVector>& InOutSplinePoints);
     FVector OnCRSplineCurve(int32 PointStart, int32 PointCount, float Time);
     FVector OnBezierCurve(int32 PointStart, int32 PointCount, float Time);
+    FVector GetPointInSegment(const FSegment& Seg, float Time);
+    FVector GetPointByArcLength(float Time);
+
+    struct FArcSample
+    {
+        float Distance;
+        int32 Segment;
+        float Time;
+    };
 
     TArray<FSegment> Segments;
     TArray<FVector> Points;
     float FullLength;
+
+    TArray<FArcSample> ArcSamples;
+    int32 LastArcSample;
 };
@@ -42,4 +42,6 @@ public:
     static void Rotate(FGTweener* Tweener);
     static void SetAlpha(FGTweener* Tweener);
     static void SetProgress(FGTweener* Tweener);
+
+    static void SetProps(UObject* Target, ETweenPropType PropType, const FTweenValue& Value);
 };
@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "EaseType.h"
+#include "TweenPropType.h"
 #include "TweenValue.h"
 #include "TweenerHandle.h"
 #include "Utils/NVariant.h"
@@ -34,6 +35,9 @@ public:
     FGTweener* SetTimeScale(float InValue);
     FGTweener* SetSnapping(bool InValue);
     FGTweener* SetTarget(UObject* InTarget);
+    //The value is written to the property of the target on every update. A tween with a property,
+    //no path, no update callback and one of the polynomial or sine eases is updated in a batch.
+    FGTweener* SetTarget(UObject* InTarget, ETweenPropType InPropType);
     UObject* GetTarget() const { return Target.Get(); }
     const FNVariant& GetUserData() const { return UserData; }
     FGTweener* SetUserData(const FNVariant& InData);
@@ -69,9 +73,17 @@ private:
     void Reset();
     void Update(float DeltaTime);
     void Update();
+    void LerpValue();
+    bool IsBatchable() const
+    {
+        return bStarted && Ended == 0 && PropType != ETweenPropType::None && ValueSize >= 1 && ValueSize <= 4
+            && Duration > 0 && Repeat == 0 && Breakpoint < 0 && EaseType <= EEaseType::QuintInOut
+            && !Path.IsValid() && !OnUpdateCallback.IsBound();
+    }
 
 private:
     TWeakObjectPtr<UObject> Target;
+    ETweenPropType PropType;
     bool bKilled;
     bool bPaused;
 
@@ -6,36 +6,78 @@
 #include "GTweener.h"
 
 class UGObject;
+class UFairyApplication;
 
 class FAIRYGUI_API FTweenManager : public FTickableGameObject
 {
 public:
+    //owns untargeted tweens, each UFairyApplication owns the tweens targeting its objects
     static FTweenManager Singleton;
 
-    FTweenManager();
+    FTweenManager(UFairyApplication* InApp = nullptr);
     virtual ~FTweenManager();
     void Reset();
 
     FGTweener* CreateTween();
 
-    bool IsTweening(FTweenerHandle const& Handle) { return GetTween(Handle) != nullptr; }
-    bool IsTweening(UObject* Target) { return GetTween(Target) != nullptr; }
+    //handles and targets are resolved across all managers
+    static bool IsTweening(FTweenerHandle const& Handle) { return GetTween(Handle) != nullptr; }
+    static bool IsTweening(UObject* Target) { return GetTween(Target) != nullptr; }
 
-    bool KillTween(FTweenerHandle & Handle, bool bCompleted);
-    bool KillTweens(UObject* Target, bool bCompleted);
+    static bool KillTween(FTweenerHandle & Handle, bool bCompleted);
+    static bool KillTweens(UObject* Target, bool bCompleted);
 
-    FGTweener* GetTween(FTweenerHandle const& Handle);
-    FGTweener* GetTween(UObject* Target);
+    static FGTweener* GetTween(FTweenerHandle const& Handle);
+    static FGTweener* GetTween(UObject* Target);
 
-    void Tick(float DeltaTime);
-    TStatId GetStatId() const {
-        return TStatId();
-    }
+    //internal use, called by FGTweener::SetTarget
+    static void SetTweenTarget(FGTweener* Tweener, UObject* Target);
+
+    int32 GetActiveTweenCount() const { return TotalActiveTweens; }
+
+    virtual void Tick(float DeltaTime) override;
+    virtual bool IsTickable() const override { return TotalActiveTweens > 0; }
+    virtual UWorld* GetTickableGameObjectWorld() const override;
+    virtual TStatId GetStatId() const override;
 
 private:
+    static void RemoveFromTargetIndex(FGTweener* Tweener);
+    static void ClearSlot(FGTweener* Tweener);
+    void AddActive(FGTweener* Tweener);
+    bool RemoveLatest(FGTweener* Tweener);
+    void AddToBatch(FGTweener* Tweener, float DeltaTime);
+    void UpdateBatches();
+
+    struct FSlot
+    {
+        FGTweener* Tweener;
+        UObject* IndexedTarget;
+        FTweenManager* Manager;
+    };
+
+    //the manager of an application only ticks with the world of its game instance
+    UFairyApplication* App;
     FGTweener** ActiveTweens;
-    TArray<FGTweener*> TweenerPool;
     int32 TotalActiveTweens;
     int32 ArrayLength;
-    uint32 TweenerInstanceCount;
+    //number of entries the running Tick walks, entries past it may still be moved to another manager
+    int32 TickingCount;
+
+    static uint32 TweenerInstanceCount;
+    //finished tweeners of every manager, tweens are always created from here through the singleton
+    static TArray<FGTweener*> TweenerPool;
+    //every tweener instance ever created sits at the index part of its handle, so a handle resolves
+    //in O(1) and a stale one fails the serial number check
+    static TArray<FSlot> Slots;
+    //raw pointers are only keys, a match is confirmed against the tweener's weak target
+    static TMap<UObject*, TArray<FGTweener*, TInlineAllocator<2>>> TargetTweens;
+
+    //simple property tweens of this frame, one bucket per batchable ease so each is eased in one loop
+    struct FTweenBatch
+    {
+        TArray<FGTweener*> Tweeners;
+        TArray<float> Times;
+    };
+    static const int32 BatchCount = (int32)EEaseType::QuintInOut + 1;
+    FTweenBatch Batches[BatchCount];
 };
\ No newline at end of file
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "TweenPropType.generated.h"
+
+UENUM()
+enum class ETweenPropType : uint8
+{
+    None,
+    X,
+    Y,
+    Position,
+    Width,
+    Height,
+    Size,
+    ScaleX,
+    ScaleY,
+    Scale,
+    Rotation,
+    Alpha,
+    Progress
+};
@@ -7,6 +7,7 @@
 class UGController;
 class UTransition;
 class SContainer;
+class FSpatialGrid;
 
 UCLASS(BlueprintType, Blueprintable)
 class FAIRYGUI_API UGComponent : public UGObject
@@ -133,6 +134,14 @@ public:
     UFUNCTION(BlueprintCallable, Category = "FairyGUI")
     void SetViewHeight(float InViewHeight);
 
+    //Keeps the children in a uniform grid of the given cell size, so view, point and bounds queries don't
+    //visit every child. Meant for components with thousands of positioned children. 0 turns it off.
+    UFUNCTION(BlueprintCallable, Category = "FairyGUI")
+    void SetChildSpatialIndex(float CellSize);
+
+    void GetChildrenInRect(const FBox2D& Rect, TArray<UGObject*>& OutChildren) const;
+    void GetChildrenAtPoint(const FVector2D& Point, TArray<UGObject*>& OutChildren) const;
+
     UFUNCTION(BlueprintCallable, Category = "FairyGUI")
     void SetBoundsChangedFlag();
 
@@ -165,12 +174,16 @@ public:
     //internal use
     void ChildSortingOrderChanged(UGObject* Child, int32 OldValue, int32 NewValue);
     void ChildStateChanged(UGObject* Child);
+    void ChildBoundsChanged(UGObject* Child) { if (ChildGrid.IsValid()) UpdateChildGrid(Child); }
     void AdjustRadioGroupDepth(UGObject* Child, UGController* Controller);
 
     virtual void ConstructFromResource() override;
     void ConstructFromResource(TArray<UGObject*>* ObjectPool, int32 PoolIndex);
 
     bool bBuildingDisplayList;
+    //display objects of new children are attached by the caller afterwards, unlike bBuildingDisplayList
+    //the children are otherwise set up as usual, e.g. buttons still update their related controllers
+    bool bBatchingChildren;
 
 protected:
     virtual void ConstructExtension(FByteBuffer* Buffer);
@@ -212,6 +225,7 @@ private:
     int32 MoveChild(UGObject* Child, int32 OldIndex, int32 NewIndex);
 
     void BuildNativeDisplayList(bool bImmediatelly = false);
+    void UpdateChildGrid(UGObject* Child);
 
     void OnAddedToStageHandler(UEventContext* Context);
     void OnRemovedFromStageHandler(UEventContext* Context);
@@ -221,6 +235,7 @@ private:
 
     FTimerHandle UpdateBoundsTimerHandle;
     FTimerHandle BuildDisplayListTimerHandle;
+    TSharedPtr<FSpatialGrid> ChildGrid;
 
     friend class UScrollPane;
 };
\ No newline at end of file
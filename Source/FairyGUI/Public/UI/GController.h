@@ -6,6 +6,7 @@
 #include "GController.generated.h"
 
 class UGComponent;
+class UGObject;
 class FByteBuffer;
 
 UCLASS(BlueprintType)
@@ -43,6 +44,9 @@ public:
     void SetOppositePageID(const FString& PageID);
     void RunActions();
 
+    //objects with a gear or another binding on this controller, only they are told about page changes
+    void AddSubscriber(UGObject* Obj);
+
     void Setup(FByteBuffer* Buffer);
 
     FString Name;
@@ -59,5 +63,19 @@ private:
     TArray<FString> PageNames;
     TIndirectArray<FControllerAction> Actions;
 
+    //slots are never moved, so a dispatch in progress can keep iterating while objects subscribe
+    struct FSubscriber
+    {
+        UGObject* Key;
+        TWeakObjectPtr<UGObject> Object;
+    };
+    void NotifySubscribers(UGComponent* Parent);
+
+    TArray<FSubscriber> Subscribers;
+    TMap<UGObject*, int32> SubscriberIndices;
+    TArray<int32> FreeSubscriberSlots;
+
     FOnChanged OnChangedEvent;
+
+    friend class UGComponent;
 };
\ No newline at end of file
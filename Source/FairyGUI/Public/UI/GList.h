@@ -1,12 +1,15 @@
 #pragma once
 
 #include "GComponent.h"
+#include "Utils/PrefixSumIndex.h"
 #include "GList.generated.h"
 
 class FGObjectPool;
 
 DECLARE_DELEGATE_TwoParams(FListItemRenderer, int32, UGObject*);
 DECLARE_DELEGATE_RetVal_OneParam(FString, FListItemProvider, int32);
+DECLARE_DELEGATE_RetVal_OneParam(FVector2D, FListItemSizeProvider, int32);
+DECLARE_DELEGATE_RetVal_OneParam(int64, FListItemKeyProvider, int32);
 
 DECLARE_DYNAMIC_DELEGATE_TwoParams(FDynListItemRenderer, int32, Index, UGObject*, Obj);
 DECLARE_DYNAMIC_DELEGATE_RetVal_OneParam(FString, FDynListItemProvider, int32, Index);
@@ -78,6 +81,10 @@ public:
     UFUNCTION(BlueprintCallable, Category = "FairyGUI")
     UGObject* AddItemFromPool(const FString& URL = "");
 
+    //Appends Count items. The display list is updated once for the whole batch instead of once per item.
+    UFUNCTION(BlueprintCallable, Category = "FairyGUI")
+    void AddItemsFromPool(int32 Count, const FString& URL = "");
+
     virtual UGObject* AddChildAt(UGObject* Child, int32 Index) override;
     virtual void RemoveChildAt(int32 Index) override;
 
@@ -157,6 +164,22 @@ public:
 
     void SetItemRenderer(const FListItemRenderer& InItemRenderer) { ItemRenderer = InItemRenderer; }
     void SetItemProvider(const FListItemProvider& InItemProvider) { ItemProvider = InItemProvider; }
+    //Called instead of the item renderer for cells whose rendering is deferred by ItemRenderBudget.
+    //If not set, such cells are hidden until they are rendered.
+    void SetItemPlaceholderRenderer(const FListItemRenderer& InRenderer) { ItemPlaceholderRenderer = InRenderer; }
+    //Virtual list only. Estimated size of an item that hasn't been measured yet, return zero to use the default item size.
+    void SetItemSizeProvider(const FListItemSizeProvider& InProvider) { ItemSizeProvider = InProvider; }
+    //Virtual list only. Identifies the data shown at an index. Measured sizes are remembered by this key.
+    //SetNumItems gives rows whose key changed the size cached for the new key, so rows keep their real size
+    //after the data is refreshed or reordered.
+    void SetItemKeyProvider(const FListItemKeyProvider& InProvider) { ItemKeyProvider = InProvider; }
+
+    UFUNCTION(BlueprintCallable, Category = "FairyGUI")
+    void ClearItemSizeCache() { MeasuredSizes.Reset(); }
+
+    //Virtual list only. The data at Index has changed but kept its key, its row restarts from the estimated size.
+    UFUNCTION(BlueprintCallable, Category = "FairyGUI")
+    void RefreshItemSize(int32 Index);
 
     UFUNCTION(BlueprintCallable, Category = "FairyGUI")
     void SetItemRenderer(const FDynListItemRenderer& InItemRenderer)
@@ -179,12 +202,29 @@ public:
     UPROPERTY(BlueprintAssignable, Category = "FairyGUI|Event")
     FGUIEventDynMDelegate OnClickItem;
 
+    UPROPERTY(BlueprintAssignable, Category = "FairyGUI|Event")
+    FGUIEventDynMDelegate OnItemDeferredRenderComplete;
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FairyGUI")
     bool bScrollItemToViewOnClick;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FairyGUI")
     bool bFoldInvisibleItems;
 
+    //Virtual list only. Max number of newly exposed cells rendered in one frame, 0 means no limit.
+    //The rest are rendered on the following frames, nearest to the view center first.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FairyGUI")
+    int32 ItemRenderBudget;
+
+    //Virtual list only. Items within this distance outside the view are created ahead of time, 0 disables prefetching.
+    //In the scrolling direction the distance grows by the speed multiplied by PrefetchTime, up to two views.
+    //Items behind are released only when they are twice the margin away.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FairyGUI")
+    float PrefetchMargin;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FairyGUI")
+    float PrefetchTime;
+
 protected:
     virtual void HandleControllerChanged(UGController* Controller) override;
     virtual void HandleSizeChanged() override;
@@ -196,7 +236,17 @@ protected:
     virtual void ReadItems(FByteBuffer* Buffer);
     virtual void SetupItem(FByteBuffer* Buffer, UGObject* Obj);
 
+    //Virtual list only, not looping. Replaces RemoveCount items at Index with InsertCount new ones and refreshes.
+    //The selection and known sizes move with their items, rendered cells stay in place and are re-rendered.
+    void SpliceVirtualItems(int32 Index, int32 RemoveCount, int32 InsertCount);
+    //Virtual list only, not looping. Moves Count items at Index to NewIndex, counted after they are taken out.
+    void MoveVirtualItems(int32 Index, int32 Count, int32 NewIndex);
+
 private:
+    int32 TakeVirtualCells(TArray<TPair<UGObject*, uint8>>& OutCells);
+    void RestoreVirtualCells(int32 Begin, const TArray<TPair<UGObject*, uint8>>& Cells);
+    void SpliceLineSizes(int32 Index, int32 RemoveCount, int32 InsertCount);
+    void RefreshSplicedItems();
     void ClearSelectionExcept(UGObject* Obj);
     void SetSelectionOnEvent(UGObject* Obj, UEventContext* Context);
 
@@ -206,6 +256,8 @@ private:
     void UpdateSelectionController(int32 Index);
 
     void SetVirtual(bool bLoop);
+    int32 BeginAddItems();
+    void EndAddItems(int32 StartIndex);
     void CheckVirtualList();
     void SetVirtualListChangedFlag(bool bLayoutChanged);
     void DoRefreshVirtualList();
@@ -217,6 +269,12 @@ private:
     int32 GetIndexOnPos3(float& pos, bool forceUpdate);
 
     void HandleScroll(bool forceUpdate);
+    void GetPrefetchMargins(int32 Axis, float& OutBefore, float& OutAfter) const;
+    FVector2D GetEstimatedItemSize(int32 Index);
+    void CacheMeasuredSize(int32 Index, const FVector2D& InSize);
+    void SetEstimatedItemSize(int32 Index, const FVector2D& InSize);
+    bool AllowItemRender(int32 Index, bool bForce);
+    void RenderDeferredItems();
     bool HandleScroll1(bool forceUpdate);
     bool HandleScroll2(bool forceUpdate);
     void HandleScroll3(bool forceUpdate);
@@ -225,6 +283,7 @@ private:
     void HandleArchOrder2();
 
     void HandleAlign(float InContentWidth, float InContentHeight);
+    void UpdateLineSizes(bool bRebuild);
 
     FString DefaultItem;
     EListLayoutType Layout;
@@ -239,6 +298,10 @@ private:
     UGController* SelectionController;
     FListItemRenderer ItemRenderer;
     FListItemProvider ItemProvider;
+    FListItemRenderer ItemPlaceholderRenderer;
+    FListItemSizeProvider ItemSizeProvider;
+    FListItemKeyProvider ItemKeyProvider;
+    TMap<int64, FVector2D> MeasuredSizes;
 
     FGObjectPool* Pool;
     int32 LastSelectedIndex;
@@ -257,14 +320,26 @@ private:
     uint32 ItemInfoVer;
     FTimerHandle RefreshTimerHandle;
 
+    //time-sliced rendering
+    TArray<int32> DeferredItems;
+    FTimerHandle DeferredRenderTimerHandle;
+    uint64 RenderBudgetFrame;
+    int32 RenderedInFrame;
+    bool bDeferredRelayout;
+    bool bDeferredRendered; //a deferred cell was rendered since the last completion event
+    float PrefetchedExtent;
+
     struct FItemInfo
     {
         FVector2D Size;
         UGObject* Obj;
         uint32 UpdateFlag;
         bool bSelected;
+        uint8 RenderState; //0-rendered, 1-deferred, 2-scheduled for this frame
+        int64 Key; //data key the size belongs to, when ItemKeyProvider is set
 
         FItemInfo();
     };
     TArray<FItemInfo> VirtualItems;
+    FPrefixSumIndex LineSizes; //main axis size of each line, taken from its first item. Not used by pagination
 };
\ No newline at end of file
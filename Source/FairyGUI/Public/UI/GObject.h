@@ -207,6 +207,14 @@ public:
     UFUNCTION(BlueprintCallable, Category = "FairyGUI")
     void RemoveRelation(UGObject* Obj, ERelationType RelationType);
 
+    //writes of animations, see FUIConfig::CoalescePropertyWrites
+    void StageX(float InX);
+    void StageY(float InY);
+    void StagePosition(const FVector2D& InPosition);
+    void StageSize(const FVector2D& InSize, bool bIgnorePivot = false);
+    void StageAlpha(float InAlpha);
+    void FlushStagedProperties();
+
     const TSharedPtr<FGearBase>& GetGear(int32 Index);
     bool CheckGearController(int32 Index, UGController* Controller);
     uint32 AddDisplayLock();
@@ -242,6 +250,7 @@ public:
     UGTreeNode* GetTreeNode() const { return TreeNode; }
 
     TSharedPtr<FPackageItem> GetPackageItem() const { return PackageItem; }
+    int32 GetResourceHandle() const { return ResourceHandle; }
     TSharedRef<SDisplayObject> GetDisplayObject() const { return DisplayObject.ToSharedRef(); }
 
     virtual IHitTest* GetHitArea() const { return nullptr; }
@@ -335,6 +344,7 @@ protected:
     TWeakObjectPtr<UGComponent> Parent;
     TSharedPtr<SDisplayObject> DisplayObject;
     TSharedPtr<FPackageItem> PackageItem;
+    int32 ResourceHandle;
 
     virtual void HandleSizeChanged();
     virtual void HandleGrayedChanged();
@@ -369,6 +379,7 @@ private:
     bool InternalVisible3() const;
     void UpdateGearFromRelations(int32 Index, const FVector2D& Delta);
     void UpdateTransform();
+    bool BeginStage();
 
     UFUNCTION()
     void OnRollOverHandler(UEventContext* Context);
@@ -400,6 +411,12 @@ private:
     uint8 bDragTesting : 1;
     UGTreeNode* TreeNode;
     UFairyApplication* CachedApp;
+    TOptional<FVector2D> StagedPosition;
+    TOptional<FVector2D> StagedSize;
+    TOptional<float> StagedAlpha;
+    uint8 bStaged : 1;
+    uint8 bStagedGearLocked : 1;
+    uint8 bStagedIgnorePivot : 1;
 
     struct FUnifiedEventDelegate
     {
@@ -422,6 +439,7 @@ private:
     friend class FRelationItem;
     friend class FUIObjectFactory;
     friend class UGTree;
+    friend class UGController;
 };
 
 template <typename T>
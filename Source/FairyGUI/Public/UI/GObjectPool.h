@@ -4,15 +4,28 @@
 #include "UObject/NoExportTypes.h"
 
 class UGObject;
+class FPackageItem;
 
 class FGObjectPool : public FGCObject
 {
 public:
+    //Resolves a resource url to the handle of its package item, 0 if not found.
+    //Urls are remembered as given, so asking again for the same string doesn't parse it again.
+    int32 GetHandle(const FString& URL);
+
     UGObject* GetObject(const FString& URL, UObject* WorldContextObject);
+    UGObject* GetObject(int32 Handle, UObject* WorldContextObject);
     void ReturnObject(UGObject* Obj);
 
     virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
 
 private:
-    TMap<FString, TArray<UGObject*>> Pool;
-};
\ No newline at end of file
+    struct FPoolEntry
+    {
+        TWeakPtr<FPackageItem> Item;
+        TArray<UGObject*> Objects;
+    };
+
+    TMap<int32, FPoolEntry> Pool;
+    TMap<FString, TWeakPtr<FPackageItem>> ResolvedURLs;
+};
@@ -12,8 +12,28 @@ public:
     UGRichTextField();
     virtual ~UGRichTextField();
 
+    virtual const FString& GetText() const override;
+    void SetText(const FString& InText) override;
+
+    UFUNCTION(BlueprintCallable, Category = "FairyGUI")
+    bool IsVirtual() const;
+
+    //each paragraph keeps its own layout, only the ones in view of the owning scroll pane are laid out and painted.
+    //the oldest paragraphs are dropped when there are more than MaxParagraphs(0 means no limit)
+    UFUNCTION(BlueprintCallable, Category = "FairyGUI")
+    void SetVirtual(bool bInVirtual, int32 MaxParagraphs = 0);
+
+    UFUNCTION(BlueprintCallable, Category = "FairyGUI")
+    void AppendText(const FString& InText);
+
     UPROPERTY(BlueprintAssignable, Category = "FairyGUI|Event")
     FGUIEventDynMDelegate OnClickLink;
 
 protected:
-};
\ No newline at end of file
+    void SyncSources(int32 AddedLength);
+
+    //virtual mode: Text is the caller's text, SourceLengths has its length for each source kept by Content
+    TArray<int32> SourceLengths;
+    int32 FirstSource;
+    int32 EvictedLength; //text of dropped sources still at the front of Text
+};
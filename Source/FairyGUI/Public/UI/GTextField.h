@@ -2,6 +2,7 @@
 
 #include "GObject.h"
 #include "Widgets/NTextFormat.h"
+#include "Utils/TextTemplate.h"
 #include "GTextField.generated.h"
 
 UCLASS(BlueprintType)
@@ -65,6 +66,7 @@ protected:
     FString ParseTemplate(const FString& Template);
 
     FString Text;
+    FTextTemplate CompiledTemplate;
     bool bUBBEnabled;
     bool bFormatApplied;
     bool bSupportHTML;
@@ -16,7 +16,10 @@ public:
     virtual const FString& GetText() const override { return Text; }
     void SetText(const FString& InText) override;
 
-    TSharedRef<SMultiLineEditableText> GetInputWidget() const;
+    //The multi-line editor, null when the input is single line and edited by SSingleLineInput
+    TSharedPtr<SMultiLineEditableText> GetInputWidget() const;
+    //The widget that currently edits the text
+    TSharedRef<SWidget> GetEditingWidget() const;
 
     UFUNCTION(BlueprintCallable, Category = "FairyGUI")
     bool IsSingleLine() const;
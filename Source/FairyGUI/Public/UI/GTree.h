@@ -39,6 +39,22 @@ public:
     UFUNCTION(BlueprintCallable, Category = "FairyGUI")
     void CollapseAll(UGTreeNode* Node);
 
+    //Turns the tree into a virtual list over its visible rows. Cells are created only for rows in view,
+    //so a node's cell may be null or change when the tree scrolls. The tree must be scrollable.
+    UFUNCTION(BlueprintCallable, Category = "FairyGUI")
+    void SetVirtualTree();
+
+    UFUNCTION(BlueprintCallable, Category = "FairyGUI")
+    bool IsVirtualTree() const { return bVirtualTree; }
+
+    //Node changes made between BeginUpdate and EndUpdate are applied to the cells once, when the outermost
+    //EndUpdate is called. Until then nodes added in the scope have no cell. Calls may be nested.
+    UFUNCTION(BlueprintCallable, Category = "FairyGUI")
+    void BeginUpdate() { UpdateLockCount++; }
+
+    UFUNCTION(BlueprintCallable, Category = "FairyGUI")
+    void EndUpdate();
+
     void SetTreeNodeRenderer(const FTreeNodeRenderer& InDelegate) { TreeNodeRenderer = InDelegate; }
     void SetOnTreeNodeWillExpand(const FOnTreeNodeWillExpand& InDelegate) { OnTreeNodeWillExpand = InDelegate; }
 
@@ -83,6 +99,18 @@ private:
     void HideFolderNode(UGTreeNode* FolderNode);
     void RemoveNode(UGTreeNode* Node);
     int32 GetFolderEndIndex(int32 StartIndex, int32 Level);
+    bool IsChildrenShown(const UGTreeNode* FolderNode) const;
+
+    //virtual tree
+    void RenderVirtualRow(int32 Index, UGObject* Obj);
+    FString GetVirtualRowURL(int32 Index);
+    void CollectVisibleRows(UGTreeNode* FolderNode, TArray<UGTreeNode*>& OutRows) const;
+    int32 GetRow(UGTreeNode* Node);
+    int32 GetInsertRowForNode(UGTreeNode* Node);
+    void UnlinkRows(int32 Row, int32 Count);
+    void SpliceRows(int32 Row, int32 RemoveCount, const TArray<UGTreeNode*>& Rows);
+    void ApplyVisibleRows(const TArray<UGTreeNode*>& SelectedNodes);
+    void RefreshRows();
 
     UFUNCTION()
     void OnCellTouchBegin(UEventContext* Context);
@@ -94,5 +122,13 @@ private:
     FTreeNodeRenderer TreeNodeRenderer;
     FOnTreeNodeWillExpand OnTreeNodeWillExpand;
 
+    bool bVirtualTree;
+    TArray<UGTreeNode*> VisibleRows; //nodes in display order, the row is the item index of the virtual list
+    int32 NumberedRows; //UGTreeNode::Row is up to date for the rows before this
+
+    int32 UpdateLockCount;
+    bool bRowsDirty;
+    TSet<UGTreeNode*> PendingRenderNodes; //folders expanded or collapsed inside an update scope
+
     friend class UGTreeNode;
 };
\ No newline at end of file
@@ -98,6 +98,8 @@ public:
 private:
     int32 MoveChild(UGTreeNode* Child, int32 OldIndex, int32 Index);
     void SetTree(UGTree* InTree);
+    int32 GetRowCount() const { return 1 + (bExpanded ? DescendantRows : 0); }
+    void ChangeDescendantRows(int32 Delta);
 
     TWeakObjectPtr<UGTree> Tree;
     TWeakObjectPtr<UGTreeNode> Parent;
@@ -107,6 +109,8 @@ private:
     TArray<UGTreeNode*> Children;
 
     int32 Level;
+    int32 DescendantRows; //rows of the children and their shown descendants, as if this folder were expanded
+    int32 Row; //last known row in a virtual tree, see UGTree::GetRow
     bool bExpanded;
     bool bIsFolder;
     FString ResourceURL;
@@ -21,6 +21,44 @@ public:
     FTweenerHandle Handle;
 };
 
+//Per-page values of a gear, indexed by controller page. Page IDs are resolved to indices when the values
+//are read, so applying a gear after a page change is an array lookup instead of a string hash.
+template<typename T>
+class TGearStorage
+{
+public:
+    bool IsEmpty() const { return Values.Num() == 0; }
+    void Reset() { Values.Reset(); }
+
+    T* Find(int32 PageIndex)
+    {
+        return Values.IsValidIndex(PageIndex) && Values[PageIndex].IsSet() ? &Values[PageIndex].GetValue() : nullptr;
+    }
+
+    void Add(int32 PageIndex, T Value)
+    {
+        if (PageIndex < 0)
+            return;
+
+        if (PageIndex >= Values.Num())
+            Values.SetNum(PageIndex + 1);
+        Values[PageIndex] = MoveTemp(Value);
+    }
+
+    template<typename FuncType>
+    void ForEach(FuncType Func)
+    {
+        for (TOptional<T>& Value : Values)
+        {
+            if (Value.IsSet())
+                Func(Value.GetValue());
+        }
+    }
+
+private:
+    TArray<TOptional<T>> Values;
+};
+
 class FGearBase
 {
 public:
@@ -60,6 +98,7 @@ public:
 protected:
     virtual void AddStatus(const FString& PageID, FByteBuffer* Buffer);
     virtual void Init();
+    int32 GetPageIndex(const FString& PageID) const;
 
     EType Type;
     UGObject* Owner;
@@ -16,6 +16,6 @@ protected:
     virtual void Init() override;
 
 private:
-    TMap<FString, int32> Storage;
+    TGearStorage<int32> Storage;
     int32 Default;
 };
\ No newline at end of file
@@ -16,6 +16,6 @@ protected:
     virtual void Init() override;
 
 private:
-    TMap<FString, FString> Storage;
+    TGearStorage<FString> Storage;
     FString Default;
 };
\ No newline at end of file
@@ -29,6 +29,6 @@ private:
         FValue();
     };
 
-    TMap<FString, FValue> Storage;
+    TGearStorage<FValue> Storage;
     FValue Default;
 };
\ No newline at end of file
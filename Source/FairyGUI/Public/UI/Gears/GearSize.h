@@ -20,6 +20,6 @@ private:
     void OnTweenUpdate(FGTweener* Tweener);
     void OnTweenComplete();
 
-    TMap<FString, FVector4> Storage;
+    TGearStorage<FVector4> Storage;
     FVector4 Default;
 };
\ No newline at end of file
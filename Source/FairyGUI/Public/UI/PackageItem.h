@@ -10,6 +10,7 @@
 class FByteBuffer;
 struct FMovieClipData;
 struct FBitmapFont;
+struct FTransitionDef;
 
 class UUIPackage;
 class UNTexture;
@@ -28,6 +29,7 @@ public:
 
 public:
     UUIPackage* Owner;
+    int32 Handle; //unique for every item ever loaded, a cheap key for pooling
 
     EPackageItemType Type;
     EObjectType ObjectType;
@@ -54,6 +56,7 @@ public:
     //component
     FGComponentCreator ExtensionCreator;
     bool bTranslated;
+    TOptional<TArray<TSharedPtr<FTransitionDef>>> Transitions;
 
     //font
     TSharedPtr<FBitmapFont> BitmapFont;
@@ -28,6 +28,13 @@ public:
     UFUNCTION(BlueprintCallable, Category = "FairyGUI")
     UGComponent* GetHeader() const { return Header; }
 
+    UFUNCTION(BlueprintGetter, Category = "FairyGUI")
+    UGController* GetPageController() const { return PageController; }
+
+    //the owner subscribes to the controller, see UGController::AddSubscriber
+    UFUNCTION(BlueprintSetter, Category = "FairyGUI")
+    void SetPageController(UGController* InController);
+
     UFUNCTION(BlueprintCallable, Category = "FairyGUI")
     UGComponent* GetFooter() const { return Footer; }
 
@@ -104,6 +111,10 @@ public:
     UFUNCTION(BlueprintCallable, Category = "FairyGUI")
     float GetScrollingPosY() const;
 
+    //Pixels per second, positive when the scroll position is increasing
+    UFUNCTION(BlueprintCallable, Category = "FairyGUI")
+    FVector2D GetScrollingVelocity() const;
+
     UFUNCTION(BlueprintCallable, Category = "FairyGUI")
     const FVector2D& GetContentSize() const { return ContentSize; }
 
@@ -145,10 +156,10 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FairyGUI")
     float ScrollStep;
 
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FairyGUI")
+private:
+    UPROPERTY(EditAnywhere, BlueprintGetter = GetPageController, BlueprintSetter = SetPageController, Category = "FairyGUI", meta = (AllowPrivateAccess = "true"))
     UGController* PageController;
 
-private:
     void OnOwnerSizeChanged();
     void AdjustMaskContainer();
     void SetContentSize(const FVector2D& InSize);
@@ -181,8 +192,11 @@ private:
     void FixDuration(int32 Axis, float DldChange);
     void StartTween(int32 Type);
     void KillTween();
-    void TweenUpdate();
+    void OnTweenTimer();
+    void TweenUpdate(float DeltaTime);
+    void StopTweenTick();
     float RunTween(int32 Axis, float Delta);
+    float GetTweenValue(int32 Axis) const;
 
     void CheckRefreshBar();
 
@@ -250,6 +264,7 @@ private:
     FVector2D TweenChange;
     FVector2D TweenTime;
     FVector2D TweenDuration;
+    double TweenStartSeconds; //frame-synced only, platform time the tween started at, until its first tick
 
     FTimerHandle RefreshTimerHandle;
     FTimerHandle TickTimerHandle;
@@ -258,6 +273,7 @@ private:
     static TWeakObjectPtr<UScrollPane> DraggingPane;
 
     friend class UGComponent;
+    friend class UFairyApplication;
     friend class UGList;
     friend class UGScrollBar;
 };
\ No newline at end of file
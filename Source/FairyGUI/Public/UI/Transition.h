@@ -11,6 +11,9 @@ class UGController;
 class FByteBuffer;
 class FGTweener;
 struct FTransitionItem;
+struct FTransitionItemDef;
+struct FTransitionDef;
+struct FTransitionTimeline;
 
 UCLASS(BlueprintType)
 class FAIRYGUI_API UTransition : public UObject
@@ -107,6 +110,10 @@ public:
     void OnOwnerRemovedFromStage();
 
     void Setup(FByteBuffer* Buffer);
+    void Setup(const TSharedPtr<FTransitionDef>& InDef);
+
+    //parses the definition that all instances of a component share, see FPackageItem::Transitions
+    static TSharedPtr<FTransitionDef> CreateDefinition(FByteBuffer* Buffer, UGComponent* InOwner);
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FairyGUI")
     FString Name;
@@ -126,10 +133,18 @@ private:
     void CallHook(FTransitionItem* Item, bool bTweenEnd);
     void CheckAllComplete();
     void ApplyValue(FTransitionItem* Item);
-    void DecodeValue(FTransitionItem* Item, FByteBuffer* Buffer, struct FTransitionItemData* Value);
+    static void DecodeValue(FTransitionItemDef* Item, FByteBuffer* Buffer, struct FTransitionItemData* Value);
+    void OnItemsModified() { bItemsModified = true; bTimelineBuilt = false; }
+    void PlayTimeline();
+    void UpdateTimeline(float Time);
+    void OnTimelineUpdate(FGTweener* Tweener);
+    void OnTimelineComplete(FGTweener* Tweener);
 
     UGComponent* Owner;
+    TSharedPtr<FTransitionDef> Def;
+    FTransitionItem* ItemStates;
     TArray<FTransitionItem*> Items;
+    bool bItemsModified;
     int32 TotalTimes;
     int32 TotalTasks;
     bool bPlaying;
@@ -146,4 +161,14 @@ private:
     float StartTime;
     float EndTime;
     FTweenerHandle DelayHandle;
+
+    //baked playback, see FUIConfig::BakedTransitions
+    TSharedPtr<FTransitionTimeline> Timeline;
+    bool bTimelineBuilt;
+    TSharedPtr<FTransitionTimeline> PlayingTimeline;
+    FTweenerHandle TimelineHandle;
+    TArray<int32> TrackKeys;
+    TArray<int32> SettledKeys;
+    int32 NextEvent;
+    int32 TimelinePlayCount;
 };
\ No newline at end of file
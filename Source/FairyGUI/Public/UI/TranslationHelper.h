@@ -4,9 +4,10 @@
 
 class FPackageItem;
 
-class FTranslationHelper
+class FAIRYGUI_API FTranslationHelper
 {
 public:
+    //keyed by package id + component id, then by element id
     static TMap<FString, TMap<FString, FString>> Strings;
 
     static void LoadFromXML(const FString XmlString);
@@ -36,6 +36,25 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FairyGUI")
     bool DefaultScrollBounceEffect;
 
+    //Drive scroll animations from the application tick with the real frame time instead of a 60Hz timer
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FairyGUI")
+    bool FrameSyncedScrolling;
+
+    //Samples per ease table for the sine, expo and elastic eases, 0 evaluates them exactly. At 256 the error
+    //stays under 0.5% of the tweened distance.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FairyGUI")
+    int32 EaseTableResolution;
+
+    //Play transitions made only of plain tweens and instant actions from keyframe tracks driven by one tweener,
+    //instead of one tweener per item. Other transitions and partial or reversed plays are not affected.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FairyGUI")
+    bool BakedTransitions;
+
+    //Let gear, transition and tween updates stage position, size and alpha, and apply them once per object before the
+    //next Slate tick. A staged value lands after any direct write of the same property made in that frame.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FairyGUI")
+    bool CoalescePropertyWrites;
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FairyGUI")
     EScrollBarDisplayType DefaultScrollBarDisplay;
 
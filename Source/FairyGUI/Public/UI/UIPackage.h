@@ -101,9 +101,11 @@ private:
     TArray<FString> Branches;
     int32 BranchIndex;
     TSet<uint32> RefWorlds;
+    TArray<FString> SourceStrings;
 
     friend class FPackageItem;
     friend class UFairyApplication;
+    friend class FTranslationHelper;
 };
 
 UCLASS(Transient)
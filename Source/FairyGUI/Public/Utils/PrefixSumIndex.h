@@ -0,0 +1,34 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+//A Fenwick tree of non-negative sizes. Changing one size, reading the running offset of an entry and
+//finding the entry under an offset are all O(log n), the total is O(1).
+//A constant gap can be added after every entry at query time, so gap changes don't need a rebuild.
+class FAIRYGUI_API FPrefixSumIndex
+{
+public:
+    FPrefixSumIndex();
+
+    int32 Num() const { return Values.Num(); }
+    void Reset();
+    void Add(float Value);
+    void Truncate(int32 NewNum);
+    //replaces RemoveCount entries at Index with InValues, only the nodes from Index on are rebuilt
+    void Splice(int32 Index, int32 RemoveCount, const TArray<float>& InValues);
+
+    float Get(int32 Index) const { return Values[Index]; }
+    void Set(int32 Index, float Value);
+
+    //sum of the first Count entries, each followed by Gap
+    float GetSum(int32 Count, float Gap) const;
+    float GetTotal(float Gap) const { return (float)Total + Values.Num() * Gap; }
+
+    //the largest count of leading entries whose sum (each followed by Gap) doesn't exceed Pos
+    int32 Find(float Pos, float Gap) const;
+
+private:
+    TArray<float> Values;
+    TArray<double> Tree;
+    double Total;
+};
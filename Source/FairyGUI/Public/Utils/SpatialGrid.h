@@ -0,0 +1,55 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UGObject;
+
+//A uniform grid over the rectangles of objects. Updating an object touches only the cells it covers,
+//and rect, point and bounds queries visit the cells involved instead of every object.
+//Objects covering too many cells are kept aside in a short list that every query checks.
+//The union of all rects is kept up to date and only recomputed after an object on its edge moves or leaves.
+class FAIRYGUI_API FSpatialGrid
+{
+public:
+    FSpatialGrid(float InCellSize);
+
+    float GetCellSize() const { return CellSize; }
+    int32 Num() const { return Entries.Num(); }
+
+    void Update(UGObject* Obj, const FBox2D& Rect);
+    void Remove(UGObject* Obj);
+    void Reset();
+
+    //objects whose rect overlaps Rect, each reported once, in no particular order
+    void Query(const FBox2D& Rect, TArray<UGObject*>& OutObjects) const;
+    void QueryPoint(const FVector2D& Point, TArray<UGObject*>& OutObjects) const;
+
+    //union of all rects, returns false if the grid is empty
+    bool GetBounds(FBox2D& OutBounds) const;
+
+    //a value stored with the object for the owner, e.g. its last known child index. INDEX_NONE if unknown
+    int32 GetIndexHint(UGObject* Obj) const;
+    void SetIndexHint(UGObject* Obj, int32 Index);
+
+private:
+    struct FEntry
+    {
+        FBox2D Rect;
+        FIntPoint MinCell;
+        FIntPoint MaxCell;
+        bool bOversized;
+        int32 IndexHint;
+    };
+
+    FIntPoint ToCell(const FVector2D& Pos) const;
+    void Link(UGObject* Obj, const FEntry& Entry);
+    void Unlink(UGObject* Obj, const FEntry& Entry);
+    bool IsOnBoundsEdge(const FBox2D& Rect) const;
+
+    float CellSize;
+    TMap<UGObject*, FEntry> Entries;
+    TMap<FIntPoint, TArray<UGObject*>> Cells;
+    TArray<UGObject*> Oversized;
+    mutable FBox2D Bounds;
+    mutable bool bBoundsDirty;
+};
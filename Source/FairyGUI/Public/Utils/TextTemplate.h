@@ -0,0 +1,42 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+//A text template compiled into literal spans and variable slots, e.g. "HP: {hp=0}/{max}".
+//Changing a variable only rewrites its slot, the text is then emitted with a single allocation.
+class FAIRYGUI_API FTextTemplate
+{
+public:
+    FTextTemplate();
+
+    void Compile(const FString& InSource, const TMap<FString, FString>& InVars);
+    void Reset();
+    bool IsCompiled() const { return bCompiled; }
+
+    bool SetVar(const FString& VarKey, const FString& VarValue);
+    void Emit(FString& OutText) const;
+
+private:
+    struct FSpan
+    {
+        int32 Start;
+        int32 Length;
+        int32 Slot;
+    };
+
+    struct FSlot
+    {
+        FString Name;
+        FString Value;
+        int32 DefaultStart;
+        int32 DefaultLength;
+        bool bHasValue;
+    };
+
+    void AddLiteral(int32 Start, int32 Length);
+
+    FString Source;
+    TArray<FSpan> Spans;
+    TArray<FSlot> Slots;
+    bool bCompiled;
+};
@@ -12,6 +12,9 @@ public:
     FNTextFormat();
     bool EqualStyle(const FNTextFormat& AnotherFormat) const;
     FTextBlockStyle GetStyle() const;
+    TSharedRef<const FTextBlockStyle> GetSharedStyle() const;
+
+    static void ClearStyleCache();
 
 public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FairyGUI")
@@ -17,6 +17,7 @@ public:
 
     void AddChild(const TSharedRef<SWidget>& SlotWidget);
     void AddChildAt(const TSharedRef<SWidget>& SlotWidget, int32 Index);
+    void AddChildren(const TArray<TSharedRef<SWidget>>& SlotWidgets);
     int32 GetChildIndex(const TSharedRef<SWidget>& SlotWidget) const;
     void SetChildIndex(const TSharedRef<SWidget>& SlotWidget, int32 Index);
     void RemoveChild(const TSharedRef<SWidget>& SlotWidget);
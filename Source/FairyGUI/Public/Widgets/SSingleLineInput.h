@@ -0,0 +1,82 @@
+#pragma once
+
+#include "STextField.h"
+#include "GenericPlatform/ITextInputMethodSystem.h"
+
+class FRegexPattern;
+
+//A one-line editor drawn through the STextField layout. It has no undo stack and no extra child widgets,
+//so an idle input costs about the same as a label.
+class FAIRYGUI_API SSingleLineInput : public STextField
+{
+public:
+    SLATE_BEGIN_ARGS(SSingleLineInput) :
+        _GObject(nullptr)
+    {}
+    SLATE_ARGUMENT(UGObject*, GObject)
+    SLATE_END_ARGS()
+
+    SSingleLineInput();
+    virtual ~SSingleLineInput();
+    void Construct(const FArguments& InArgs);
+
+    const FString& GetInputText() const { return InputText; }
+    void SetInputText(const FString& InText);
+
+    void SetPrompt(const FString& InPrompt);
+    void SetPassword(bool bInPassword);
+    void SetMaxLength(int32 InMaxLength);
+    void SetRestrict(const FString& InRestrict);
+    void SetOnTextChanged(FOnTextChanged Callback) { OnTextChangedCallback = Callback; }
+    void SetOnTextCommitted(FOnTextCommitted Callback) { OnTextCommittedCallback = Callback; }
+
+    void SelectAll();
+
+    virtual bool SupportsKeyboardFocus() const override { return true; }
+    virtual FReply OnFocusReceived(const FGeometry& MyGeometry, const FFocusEvent& InFocusEvent) override;
+    virtual void OnFocusLost(const FFocusEvent& InFocusEvent) override;
+    virtual FReply OnKeyChar(const FGeometry& MyGeometry, const FCharacterEvent& InCharacterEvent) override;
+    virtual FReply OnKeyDown(const FGeometry& MyGeometry, const FKeyEvent& InKeyEvent) override;
+    virtual FReply OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+    virtual FReply OnMouseButtonUp(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+    virtual FReply OnMouseMove(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+    virtual FReply OnMouseButtonDoubleClick(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+
+protected:
+    virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+    virtual void SetupLayout(const TSharedRef<FSlateTextLayout>& InLayout) const override;
+
+    void ReplaceRange(int32 BeginIndex, int32 Length, const FString& InText, bool bValidate);
+    void ReplaceSelection(const FString& InText);
+    void ValidateInput(FString& InOutText, int32 InRemainLength) const;
+    void SetCaret(int32 InPosition, bool bExtendSelection);
+    bool HasSelection() const { return CaretPosition != SelectionAnchor; }
+    int32 GetCharIndexAt(const FGeometry& MyGeometry, const FVector2D& ScreenPosition) const;
+    FVector2D GetCharLocation(int32 Index) const;
+    float GetLineHeight() const;
+    FVector2D GetTextOffset() const;
+    void UpdateDisplayText();
+    void NotifyTextChanged(int32 BeginIndex, int32 OldLength, int32 NewLength);
+
+    FString InputText;
+    FString Prompt;
+    bool bPassword;
+    int32 MaxLength;
+    TSharedPtr<FRegexPattern> RestrictPattern;
+    int32 CaretPosition;
+    int32 SelectionAnchor;
+    bool bFocused;
+    bool bSelecting;
+    double LastInputTime;
+    mutable float ScrollX;
+    FOnTextChanged OnTextChangedCallback;
+    FOnTextCommitted OnTextCommittedCallback;
+
+    bool bComposing;
+    int32 CompositionBegin;
+    int32 CompositionLength;
+    TSharedPtr<ITextInputMethodContext> TextInputMethodContext;
+    TSharedPtr<ITextInputMethodChangeNotifier> TextInputMethodChangeNotifier;
+
+    friend class FSingleLineInputMethodContext;
+};
@@ -20,9 +20,16 @@ public:
         STextField();
     void Construct(const FArguments& InArgs);
 
-    const FString& GetText() const { return Text; }
+    const FString& GetText() const;
     void SetText(const FString& InText, bool bInHTML = false);
 
+    bool IsVirtual() const { return bVirtual; }
+    void SetVirtual(bool bInVirtual, int32 InMaxParagraphs = 0);
+    void AppendText(const FString& InText, bool bInHTML = false);
+    int32 GetParagraphCount() const { return Paragraphs.Num(); }
+    //Virtual mode: one source per non-empty SetText/AppendText, the oldest are dropped with their paragraphs
+    int32 GetSourceCount() const { return Sources.Num(); }
+
     EAutoSizeType GetAutoSize() const { return AutoSize; };
     void SetAutoSize(EAutoSizeType InAutoSize);
 
@@ -45,8 +52,17 @@ protected:
     virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
     virtual bool ComputeVolatility() const override { return true; }
     void UpdateTextLayout();
+    virtual void SetupLayout(const TSharedRef<FSlateTextLayout>& InLayout) const;
+
+    void BuildLines(const TArray<FHTMLElement>& InElements, TArray<FTextLayout::FNewLineData>& OutLines) const;
 
-    void BuildLines();
+    void ParseElements(const FString& InText, bool bInHTML, TArray<FHTMLElement>& OutElements) const;
+    void AddParagraphs(const FString& InText, bool bInHTML, bool bMeasure);
+    void EvictParagraphs();
+    void RebuildParagraphs();
+    void UpdateVirtualLayout();
+    void GetVisibleRange(float& OutTop, float& OutBottom) const;
+    int32 PaintParagraphs(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const;
 
 protected:
     FString Text;
@@ -58,4 +74,37 @@ protected:
 
     TSharedRef<FSlateTextLayout> TextLayout;
     TArray<FHTMLElement> HTMLElements;
+
+    //Virtual mode: every logical line owns a layout, only the ones in view are laid out and painted
+    struct FParagraph
+    {
+        TSharedRef<FSlateTextLayout> Layout;
+        float Offset;
+        float Height;
+        bool bMeasured;
+
+        FParagraph(const TSharedRef<FSlateTextLayout>& InLayout) :
+            Layout(InLayout), Offset(0), Height(0), bMeasured(false)
+        {
+        }
+    };
+
+    struct FParagraphSource
+    {
+        FString Text;
+        bool bHTML;
+        int32 ParagraphCount;
+    };
+
+    bool bVirtual;
+    int32 MaxParagraphs;
+    TArray<FParagraph> Paragraphs;
+    TArray<FParagraphSource> Sources;
+    int32 EvictedInFirstSource;
+    int32 OffsetDirtyIndex;
+    float BaseOffset;
+    float LayoutWidth;
+    float LayoutScale;
+    bool bSourceTextDirty;
+    TSharedPtr<IBreakIterator> LineBreakIterator;
 };
\ No newline at end of file
@@ -3,6 +3,9 @@
 #include "SDisplayObject.h"
 #include "NTextFormat.h"
 
+class SMultiLineEditableText;
+class SSingleLineInput;
+
 class FAIRYGUI_API STextInput : public SDisplayObject
 {
 public:
@@ -15,18 +18,40 @@ public:
     STextInput();
     void Construct(const FArguments& InArgs);
 
+    void SetText(const FString& InText);
+    void SetPrompt(const FString& InPrompt);
     void SetPassword(bool bInPassword);
+    bool IsSingleLine() const { return bSingleLine; }
     void SetSingleLine(bool bInSingleLine);
+    void SetMaxLength(int32 InMaxLength);
+    void SetRestrict(const FString& InRestrict);
     void SetTextFormat(const FNTextFormat& InTextFormat);
     void SetOnTextChanged(FOnTextChanged Callback);
     void SetOnTextCommitted(FOnTextCommitted Callback);
 
+    //The editing widget is created on first use. Single line inputs use SSingleLineInput and never create
+    //the multi-line editor, except on platforms that need a virtual keyboard
+    TSharedRef<SWidget> GetWidget();
+
     virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
     virtual FChildren* GetChildren() override;
     virtual void OnArrangeChildren(const FGeometry& AllottedGeometry, FArrangedChildren& ArrangedChildren) const override;
 
-    TSharedRef<class SMultiLineEditableText> Widget;
+    //The multi-line editor, null while SSingleLineInput is used
+    TSharedPtr<SMultiLineEditableText> Widget;
 
 protected:
+    bool UsesSingleLineWidget() const;
+
     FSimpleSlot ChildSlot;
-};
\ No newline at end of file
+    TSharedPtr<SSingleLineInput> SingleLineWidget;
+
+    bool bSingleLine;
+    bool bPassword;
+    int32 MaxLength;
+    FString Restrict;
+    FString Prompt;
+    FNTextFormat TextFormat;
+    FOnTextChanged OnTextChangedCallback;
+    FOnTextCommitted OnTextCommittedCallback;
+};